@@ -0,0 +1,2 @@
+--
+ALTER TABLE `mail` ADD KEY `idx_expire_time` (`expire_time`);
@@ -0,0 +1,9 @@
+--
+DELETE FROM `command` WHERE `name` IN ('debug scriptprofile', 'debug scriptprofile enable', 'debug scriptprofile disable', 'debug scriptprofile reset', 'debug scriptprofile show', 'debug scriptprofile dump');
+INSERT INTO `command` (`name`, `security`, `help`) VALUES
+('debug scriptprofile', 3, 'Syntax: .debug scriptprofile $subcommand\r\nType .debug scriptprofile to see the list of possible subcommands or .help debug scriptprofile $subcommand to see info on subcommands'),
+('debug scriptprofile enable', 3, 'Syntax: .debug scriptprofile enable\r\n\r\nStart accounting the time spent in spell effects, aura ticks, spell and aura script hooks, creature AI and instance scripts.'),
+('debug scriptprofile disable', 3, 'Syntax: .debug scriptprofile disable\r\n\r\nStop accounting script time. Collected data is kept.'),
+('debug scriptprofile reset', 3, 'Syntax: .debug scriptprofile reset\r\n\r\nClear the collected script profile data.'),
+('debug scriptprofile show', 3, 'Syntax: .debug scriptprofile show [#count]\r\n\r\nShow the #count (default 10) entries with the highest total time.'),
+('debug scriptprofile dump', 3, 'Syntax: .debug scriptprofile dump\r\n\r\nAppend the full script profile to ScriptProfiler.DumpFile.');
@@ -0,0 +1,108 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _ALIAS_TABLE_H
+#define _ALIAS_TABLE_H
+
+#include "Define.h"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace Acore
+{
+    /**
+     * Walker/Vose alias table: picks an index with probability proportional to
+     * its weight in constant time, whatever the number of entries.
+     *
+     * Built once from the weights, then every Pick() costs one multiplication
+     * and one comparison. Negative weights are treated as 0.
+     */
+    class AliasTable
+    {
+    public:
+        AliasTable() = default;
+        explicit AliasTable(std::vector<double> const& weights) { Build(weights); }
+
+        void Build(std::vector<double> const& weights)
+        {
+            std::size_t const count = weights.size();
+            _probability.assign(count, 1.0);
+            _alias.resize(count);
+            for (std::size_t i = 0; i < count; ++i)
+                _alias[i] = i;
+
+            double total = 0.0;
+            for (double weight : weights)
+                total += std::max(weight, 0.0);
+
+            if (!count || total <= 0.0)
+                return;
+
+            std::vector<double> scaled(count);
+            std::vector<std::size_t> small, large;
+            small.reserve(count);
+            large.reserve(count);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                scaled[i] = std::max(weights[i], 0.0) * count / total;
+                (scaled[i] < 1.0 ? small : large).push_back(i);
+            }
+
+            while (!small.empty() && !large.empty())
+            {
+                std::size_t const less = small.back();
+                small.pop_back();
+                std::size_t const more = large.back();
+
+                _probability[less] = scaled[less];
+                _alias[less] = more;
+
+                scaled[more] -= 1.0 - scaled[less];
+                if (scaled[more] < 1.0)
+                {
+                    large.pop_back();
+                    small.push_back(more);
+                }
+            }
+
+            // whatever is left only differs from 1 by rounding errors
+            for (std::size_t i : small)
+                _probability[i] = 1.0;
+            for (std::size_t i : large)
+                _probability[i] = 1.0;
+        }
+
+        [[nodiscard]] bool empty() const { return _probability.empty(); }
+        [[nodiscard]] std::size_t size() const { return _probability.size(); }
+
+        /// roll must be uniformly distributed in [0, 1)
+        [[nodiscard]] std::size_t Pick(double roll) const
+        {
+            double const scaled = roll * _probability.size();
+            std::size_t const index = std::min(std::size_t(scaled), _probability.size() - 1);
+            return (scaled - index) < _probability[index] ? index : _alias[index];
+        }
+
+    private:
+        std::vector<double> _probability;
+        std::vector<std::size_t> _alias;
+    };
+}
+
+#endif
@@ -0,0 +1,174 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _POOLED_ALLOCATOR_H
+#define _POOLED_ALLOCATOR_H
+
+#include "Define.h"
+#include <array>
+#include <cstddef>
+#include <new>
+
+namespace Acore
+{
+    /**
+     * Per-thread cache of recently freed memory blocks, bucketed by size.
+     *
+     * Every block is a plain ::operator new allocation, so a block may be
+     * released on a different thread than the one that allocated it: it simply
+     * ends up in the cache of the releasing thread. Each bucket keeps at most
+     * MaxBlocksPerBucket blocks, anything beyond that goes back to the heap.
+     */
+    class BlockCache
+    {
+    public:
+        static constexpr std::size_t Granularity = 16;
+        static constexpr std::size_t MaxBlockSize = 8192;
+        static constexpr std::size_t MaxBlocksPerBucket = 512;
+
+        static void* Allocate(std::size_t size)
+        {
+            BlockCache* cache = Instance();
+            if (size > MaxBlockSize || !cache)
+                return ::operator new(size > MaxBlockSize ? size : BucketSize(BucketIndex(size)));
+
+            std::size_t const index = BucketIndex(size);
+            Bucket& bucket = cache->_buckets[index];
+            if (FreeBlock* block = bucket.Head)
+            {
+                bucket.Head = block->Next;
+                --bucket.Count;
+                return block;
+            }
+
+            return ::operator new(BucketSize(index));
+        }
+
+        static void Deallocate(void* ptr, std::size_t size) noexcept
+        {
+            if (!ptr)
+                return;
+
+            BlockCache* cache = Instance();
+            if (size > MaxBlockSize || !cache)
+            {
+                ::operator delete(ptr);
+                return;
+            }
+
+            Bucket& bucket = cache->_buckets[BucketIndex(size)];
+            if (bucket.Count >= MaxBlocksPerBucket)
+            {
+                ::operator delete(ptr);
+                return;
+            }
+
+            FreeBlock* block = static_cast<FreeBlock*>(ptr);
+            block->Next = bucket.Head;
+            bucket.Head = block;
+            ++bucket.Count;
+        }
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* Next;
+        };
+
+        struct Bucket
+        {
+            FreeBlock* Head = nullptr;
+            std::size_t Count = 0;
+        };
+
+        static constexpr std::size_t BucketCount = MaxBlockSize / Granularity;
+
+        static constexpr std::size_t BucketIndex(std::size_t size)
+        {
+            return size ? (size - 1) / Granularity : 0;
+        }
+
+        static constexpr std::size_t BucketSize(std::size_t index)
+        {
+            return (index + 1) * Granularity;
+        }
+
+        BlockCache() = default;
+
+        ~BlockCache()
+        {
+            Destroyed() = true;
+
+            for (Bucket& bucket : _buckets)
+            {
+                while (FreeBlock* block = bucket.Head)
+                {
+                    bucket.Head = block->Next;
+                    ::operator delete(block);
+                }
+                bucket.Count = 0;
+            }
+        }
+
+        // Blocks released while the thread is shutting down (after its cache is gone) bypass the cache
+        static bool& Destroyed()
+        {
+            thread_local bool destroyed = false;
+            return destroyed;
+        }
+
+        static BlockCache* Instance()
+        {
+            if (Destroyed())
+                return nullptr;
+
+            thread_local BlockCache cache;
+            return &cache;
+        }
+
+        std::array<Bucket, BucketCount> _buckets;
+    };
+
+    /**
+     * Base class giving derived types class-level operator new/delete backed by
+     * the BlockCache. Works for polymorphic hierarchies as long as the base has a
+     * virtual destructor, since the sized delete then receives the dynamic size.
+     */
+    struct PooledObject
+    {
+        static void* operator new(std::size_t size) { return BlockCache::Allocate(size); }
+        static void operator delete(void* ptr, std::size_t size) noexcept { BlockCache::Deallocate(ptr, size); }
+    };
+
+    /// Standard allocator for node based containers (std::list, std::map...) drawing its nodes from the BlockCache.
+    template<class T>
+    struct PooledAllocator
+    {
+        using value_type = T;
+
+        PooledAllocator() noexcept = default;
+        template<class U> PooledAllocator(PooledAllocator<U> const&) noexcept { }
+
+        T* allocate(std::size_t n) { return static_cast<T*>(BlockCache::Allocate(n * sizeof(T))); }
+        void deallocate(T* ptr, std::size_t n) noexcept { BlockCache::Deallocate(ptr, n * sizeof(T)); }
+
+        template<class U> bool operator==(PooledAllocator<U> const&) const noexcept { return true; }
+        template<class U> bool operator!=(PooledAllocator<U> const&) const noexcept { return false; }
+    };
+}
+
+#endif
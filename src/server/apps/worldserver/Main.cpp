@@ -26,6 +26,7 @@
 #include "Banner.h"
 #include "BattlegroundMgr.h"
 #include "BigNumber.h"
+#include "ChannelFanout.h"
 #include "CliRunnable.h"
 #include "Common.h"
 #include "Config.h"
@@ -33,12 +34,14 @@
 #include "DatabaseLoader.h"
 #include "DeadlineTimer.h"
 #include "GitRevision.h"
+#include "GuildMgr.h"
 #include "IoContext.h"
 #include "MapMgr.h"
 #include "Metric.h"
 #include "ModuleMgr.h"
 #include "ModulesScriptLoader.h"
 #include "MySQLThreading.h"
+#include "ObjectAccessor.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvPMgr.h"
 #include "ProcessPriority.h"
@@ -49,6 +52,7 @@
 #include "ScriptMgr.h"
 #include "SecretMgr.h"
 #include "SharedDefines.h"
+#include "SQLOperationQueue.h"
 #include "World.h"
 #include "WowConnection.h"
 #include "WowConnectionNet.h"
@@ -294,6 +298,25 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+        METRIC_VALUE("player_lookup_contended", ObjectAccessor::GetPlayerLookupContendedReads());
+        METRIC_VALUE("player_name_lookup_contended", ObjectAccessor::GetPlayerNameLookupContendedReads());
+
+        static std::pair<SQLOperationPriority, char const*> const lanes[MAX_SQL_PRIORITY] =
+        {
+            { SQL_PRIORITY_HIGH, "high" },
+            { SQL_PRIORITY_NORMAL, "normal" },
+            { SQL_PRIORITY_LOW, "low" }
+        };
+
+        for (auto const& [priority, lane] : lanes)
+        {
+            SQLQueueLaneStats const stats = CharacterDatabase.GetQueueStats(priority);
+            METRIC_VALUE("db_queue_character_lane", uint64(stats.Depth), METRIC_TAG("lane", lane));
+            METRIC_VALUE("db_queue_character_wait_avg", uint64(stats.GetAverageWait().count()), METRIC_TAG("lane", lane));
+            METRIC_VALUE("db_queue_character_wait_max", uint64(stats.MaxWait.count()), METRIC_TAG("lane", lane));
+        }
+
+        CharacterDatabase.ResetQueueMaxWait();
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
@@ -364,6 +387,7 @@ int main(int argc, char** argv)
     {
         sWorld->KickAll();              // save and kick all players
         sWorld->UpdateUsers(1);      // real players unload required UpdateUsers call
+        sGuildMgr->SavePendingLogs();   // write the guild log journal
 
         sWorldSocketMgr.StopNetwork();
 
@@ -371,6 +395,13 @@ int main(int argc, char** argv)
         ClearOnlineAccounts();
     });
 
+    // Launch the channel message fan-out thread, stopped before the network goes down
+    sChannelFanout->Start();
+    std::shared_ptr<void> channelFanoutHandle(nullptr, [](void*)
+    {
+        sChannelFanout->Stop();
+    });
+
     // Set server online (allow connecting now)
     LoginDatabase.DirectExecute("UPDATE realmlist SET flag = flag & ~{}, population = 0 WHERE id = '{}'", REALM_FLAG_VERSION_MISMATCH, realm.Id.Realm);
     realm.PopulationLevel = 0.0f;
@@ -57,6 +57,11 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
 
         pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
 
+        uint8 const priorityThreads = sConfigMgr->GetOption<uint8>(name + "Database.PriorityThreads", 0);
+        uint32 const backpressureQueueSize = sConfigMgr->GetOption<uint32>(name + "Database.BackpressureQueueSize", 0);
+
+        pool.SetQueuePolicy(priorityThreads, backpressureQueueSize);
+
         if (uint32 error = pool.Open())
         {
             // Try reconnect
@@ -16,13 +16,13 @@
  */
 
 #include "DatabaseWorker.h"
-#include "PCQueue.h"
-#include "SQLOperation.h"
+#include "SQLOperationQueue.h"
 
-DatabaseWorker::DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection)
+DatabaseWorker::DatabaseWorker(SQLOperationQueue* newQueue, MySQLConnection* connection)
 {
     _connection = connection;
     _queue = newQueue;
+    _lowestPriority = _queue->RegisterWorker();
     _cancelationToken = false;
     _workerThread = std::thread(&DatabaseWorker::WorkerThread, this);
 }
@@ -34,6 +34,8 @@ DatabaseWorker::~DatabaseWorker()
     _queue->Cancel();
 
     _workerThread.join();
+
+    _queue->UnregisterWorker(_lowestPriority);
 }
 
 void DatabaseWorker::WorkerThread()
@@ -43,9 +45,7 @@ void DatabaseWorker::WorkerThread()
 
     for (;;)
     {
-        SQLOperation* operation = nullptr;
-
-        _queue->WaitAndPop(operation);
+        SQLOperation* operation = _queue->WaitAndPop(_lowestPriority);
 
         if (_cancelationToken || !operation)
             return;
@@ -19,24 +19,23 @@
 #define _WORKERTHREAD_H
 
 #include "Define.h"
+#include "SQLOperation.h"
 #include <atomic>
 #include <thread>
 
-template <typename T>
-class ProducerConsumerQueue;
-
 class MySQLConnection;
-class SQLOperation;
+class SQLOperationQueue;
 
 class AC_DATABASE_API DatabaseWorker
 {
 public:
-    DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection);
+    DatabaseWorker(SQLOperationQueue* newQueue, MySQLConnection* connection);
     ~DatabaseWorker();
 
 private:
-    ProducerConsumerQueue<SQLOperation*>* _queue;
+    SQLOperationQueue* _queue;
     MySQLConnection* _connection;
+    SQLOperationPriority _lowestPriority; //! Lowest priority lane this worker serves
 
     void WorkerThread();
     std::thread _workerThread;
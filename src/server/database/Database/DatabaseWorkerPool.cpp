@@ -23,14 +23,14 @@
 #include "LoginDatabase.h"
 #include "MySQLPreparedStatement.h"
 #include "MySQLWorkaround.h"
-#include "PCQueue.h"
 #include "PreparedStatement.h"
 #include "QueryCallback.h"
 #include "QueryHolder.h"
 #include "QueryResult.h"
-#include "SQLOperation.h"
+#include "SQLOperationQueue.h"
 #include "Transaction.h"
 #include "WorldDatabase.h"
+#include <algorithm>
 #include <limits>
 #include <mysqld_error.h>
 #include <sstream>
@@ -53,7 +53,8 @@ class PingOperation : public SQLOperation
 
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool() :
-    _queue(new ProducerConsumerQueue<SQLOperation*>()),
+    _queue(new SQLOperationQueue()),
+    _backpressureQueueSize(0),
     _async_threads(0),
     _synch_threads(0)
 {
@@ -88,6 +89,19 @@ void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8
     _synch_threads = synchThreads;
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::SetQueuePolicy(uint8 const priorityThreads, uint32 const backpressureQueueSize)
+{
+    // Always keep at least one worker serving every lane
+    uint8 const reserved = std::min<uint8>(priorityThreads, _async_threads ? _async_threads - 1 : 0);
+    if (reserved != priorityThreads)
+        LOG_WARN("sql.driver", "DatabasePool '{}': {} priority threads requested but only {} asynchronous connections are available, reserving {}.",
+            GetDatabaseName(), priorityThreads, _async_threads, reserved);
+
+    _queue->SetReservedWorkers(reserved);
+    _backpressureQueueSize = backpressureQueueSize;
+}
+
 template <class T>
 uint32 DatabaseWorkerPool<T>::Open()
 {
@@ -96,6 +110,9 @@ uint32 DatabaseWorkerPool<T>::Open()
     LOG_INFO("sql.driver", "Opening DatabasePool '{}'. Asynchronous connections: {}, synchronous connections: {}.",
         GetDatabaseName(), _async_threads, _synch_threads);
 
+    // the workers of a previous Open() cancelled the queue when they stopped
+    _queue->Reopen();
+
     uint32 error = OpenConnections(IDX_ASYNC, _async_threads);
 
     if (error)
@@ -225,22 +242,22 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(std::string_view sql)
 }
 
 template <class T>
-QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
+QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt, SQLOperationPriority priority)
 {
     PreparedStatementTask* task = new PreparedStatementTask(stmt, true);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     PreparedQueryResultFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, priority);
     return QueryCallback(std::move(result));
 }
 
 template <class T>
-SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
+SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, SQLOperationPriority priority)
 {
     SQLQueryHolderTask* task = new SQLQueryHolderTask(holder);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, priority);
     return { std::move(holder), std::move(result) };
 }
 
@@ -251,7 +268,7 @@ SQLTransaction<T> DatabaseWorkerPool<T>::BeginTransaction()
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
+void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction, SQLOperationPriority priority)
 {
 #ifdef ACORE_DEBUG
     //! Only analyze transaction weaknesses in Debug mode.
@@ -270,11 +287,11 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
     }
 #endif // ACORE_DEBUG
 
-    Enqueue(new TransactionTask(transaction));
+    Enqueue(new TransactionTask(transaction), priority);
 }
 
 template <class T>
-TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction)
+TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction, SQLOperationPriority priority)
 {
 #ifdef ACORE_DEBUG
     //! Only analyze transaction weaknesses in Debug mode.
@@ -295,7 +312,7 @@ TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction
 
     TransactionWithResultTask* task = new TransactionWithResultTask(transaction);
     TransactionFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, priority);
     return TransactionCallback(std::move(result));
 }
 
@@ -368,7 +385,7 @@ void DatabaseWorkerPool<T>::KeepAlive()
     auto const count = _connections[IDX_ASYNC].size();
 
     for (uint8 i = 0; i < count; ++i)
-        Enqueue(new PingOperation);
+        Enqueue(new PingOperation, SQL_PRIORITY_LOW);
 }
 
 /**
@@ -479,9 +496,9 @@ unsigned long DatabaseWorkerPool<T>::EscapeString(char* to, char const* from, un
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op)
+void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op, SQLOperationPriority priority)
 {
-    _queue->Push(op);
+    _queue->Push(op, priority);
 }
 
 template <class T>
@@ -490,6 +507,30 @@ std::size_t DatabaseWorkerPool<T>::QueueSize() const
     return _queue->Size();
 }
 
+template <class T>
+std::size_t DatabaseWorkerPool<T>::QueueSize(SQLOperationPriority priority) const
+{
+    return _queue->Size(priority);
+}
+
+template <class T>
+SQLQueueLaneStats DatabaseWorkerPool<T>::GetQueueStats(SQLOperationPriority priority) const
+{
+    return _queue->GetStats(priority);
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::ResetQueueMaxWait()
+{
+    _queue->ResetMaxWait();
+}
+
+template <class T>
+bool DatabaseWorkerPool<T>::ShouldDefer() const
+{
+    return _backpressureQueueSize && _queue->Size() >= _backpressureQueueSize;
+}
+
 template <class T>
 T* DatabaseWorkerPool<T>::GetFreeConnection()
 {
@@ -535,10 +576,10 @@ void DatabaseWorkerPool<T>::Execute(std::string_view sql)
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt)
+void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt, SQLOperationPriority priority)
 {
     PreparedStatementTask* task = new PreparedStatementTask(stmt);
-    Enqueue(task);
+    Enqueue(task, priority);
 }
 
 template <class T>
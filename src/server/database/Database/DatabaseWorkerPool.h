@@ -20,6 +20,7 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "SQLOperation.h"
 #include "StringFormat.h"
 #include <array>
 #include <vector>
@@ -52,11 +53,9 @@
 */
 #define MIN_MARIADB_SERVER_VERSION "10.5.0"
 
-template <typename T>
-class ProducerConsumerQueue;
-
-class SQLOperation;
+class SQLOperationQueue;
 struct MySQLConnectionInfo;
+struct SQLQueueLaneStats;
 
 template <class T>
 class DatabaseWorkerPool
@@ -76,6 +75,10 @@ public:
 
     void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads);
 
+    //! Reserves asynchronous workers for SQL_PRIORITY_HIGH and sets the queue depth above which
+    //! deferrable producers should back off (0 disables backpressure). Must be called before Open().
+    void SetQueuePolicy(uint8 const priorityThreads, uint32 const backpressureQueueSize);
+
     uint32 Open();
     void Close();
 
@@ -108,7 +111,7 @@ public:
 
     //! Enqueues a one-way SQL operation in prepared statement format that will be executed asynchronously.
     //! Statement must be prepared with CONNECTION_ASYNC flag.
-    void Execute(PreparedStatement<T>* stmt);
+    void Execute(PreparedStatement<T>* stmt, SQLOperationPriority priority = SQL_PRIORITY_NORMAL);
 
     /**
         Direct synchronous one-way statement methods.
@@ -168,13 +171,13 @@ public:
     //! Enqueues a query in prepared format that will set the value of the PreparedQueryResultFuture return object as soon as the query is executed.
     //! The return value is then processed in ProcessQueryCallback methods.
     //! Statement must be prepared with CONNECTION_ASYNC flag.
-    QueryCallback AsyncQuery(PreparedStatement<T>* stmt);
+    QueryCallback AsyncQuery(PreparedStatement<T>* stmt, SQLOperationPriority priority = SQL_PRIORITY_NORMAL);
 
     //! Enqueues a vector of SQL operations (can be both adhoc and prepared) that will set the value of the QueryResultHolderFuture
     //! return object as soon as the query is executed.
     //! The return value is then processed in ProcessQueryCallback methods.
     //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
-    SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder);
+    SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, SQLOperationPriority priority = SQL_PRIORITY_NORMAL);
 
     /**
         Transaction context methods.
@@ -185,11 +188,11 @@ public:
 
     //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
-    void CommitTransaction(SQLTransaction<T> transaction);
+    void CommitTransaction(SQLTransaction<T> transaction, SQLOperationPriority priority = SQL_PRIORITY_NORMAL);
 
     //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
-    TransactionCallback AsyncCommitTransaction(SQLTransaction<T> transaction);
+    TransactionCallback AsyncCommitTransaction(SQLTransaction<T> transaction, SQLOperationPriority priority = SQL_PRIORITY_NORMAL);
 
     //! Directly executes a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
@@ -228,13 +231,22 @@ public:
     }
 
     [[nodiscard]] std::size_t QueueSize() const;
+    [[nodiscard]] std::size_t QueueSize(SQLOperationPriority priority) const;
+
+    //! Depth, throughput and wait time of a single queue lane.
+    [[nodiscard]] SQLQueueLaneStats GetQueueStats(SQLOperationPriority priority) const;
+    void ResetQueueMaxWait();
+
+    //! Returns true when the asynchronous queue grew past the configured backpressure limit.
+    //! Producers of deferrable work (autosaves, expiry) should postpone it while this holds.
+    [[nodiscard]] bool ShouldDefer() const;
 
 private:
     uint32 OpenConnections(InternalIndex type, uint8 numConnections);
 
     unsigned long EscapeString(char* to, char const* from, unsigned long length);
 
-    void Enqueue(SQLOperation* op);
+    void Enqueue(SQLOperation* op, SQLOperationPriority priority = SQL_PRIORITY_NORMAL);
 
     //! Gets a free connection in the synchronous connection pool.
     //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
@@ -243,7 +255,8 @@ private:
     [[nodiscard]] std::string_view GetDatabaseName() const;
 
     //! Queue shared by async worker threads.
-    std::unique_ptr<ProducerConsumerQueue<SQLOperation*>> _queue;
+    std::unique_ptr<SQLOperationQueue> _queue;
+    uint32 _backpressureQueueSize;
     std::array<std::vector<std::unique_ptr<T>>, IDX_SIZE> _connections;
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
     std::vector<uint8> _preparedStatementSize;
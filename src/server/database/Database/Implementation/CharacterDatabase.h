@@ -99,6 +99,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_SEL_CHARACTER_QUESTSTATUSREW,
     CHAR_SEL_ACCOUNT_INSTANCELOCKTIMES,
     CHAR_SEL_MAILITEMS,
+    CHAR_SEL_MAIL_ITEM_HEADERS,
     CHAR_SEL_BREW_OF_THE_MONTH,
     CHAR_REP_BREW_OF_THE_MONTH,
     CHAR_SEL_AUCTION_ITEMS,
@@ -534,7 +535,7 @@ public:
 
     //- Constructors for sync and async connections
     CharacterDatabaseConnection(MySQLConnectionInfo& connInfo);
-    CharacterDatabaseConnection(ProducerConsumerQueue<SQLOperation*>* q, MySQLConnectionInfo& connInfo);
+    CharacterDatabaseConnection(SQLOperationQueue* q, MySQLConnectionInfo& connInfo);
     ~CharacterDatabaseConnection() override;
 
     //- Loads database type specific prepared statements
@@ -27,10 +27,16 @@
 #include "Timer.h"
 #include "Tokenize.h"
 #include "Transaction.h"
+#include <algorithm>
+#include <cctype>
 #include <errmsg.h>
+#include <limits>
 #include <mysql.h>
 #include <mysqld_error.h>
 
+/// Upper bound of rows coalesced into a single batched statement
+constexpr uint32 MAX_BATCHED_ROWS = 64;
+
 MySQLConnectionInfo::MySQLConnectionInfo(std::string_view infoString)
 {
     std::vector<std::string_view> tokens = Acore::Tokenize(infoString, ';', true);
@@ -56,7 +62,7 @@ MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo) :
     m_connectionInfo(connInfo),
     m_connectionFlags(CONNECTION_SYNCH) { }
 
-MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo) :
+MySQLConnection::MySQLConnection(SQLOperationQueue* queue, MySQLConnectionInfo& connInfo) :
     m_reconnecting(false),
     m_prepareError(false),
     m_Mysql(nullptr),
@@ -77,6 +83,7 @@ void MySQLConnection::Close()
     // Stop the worker thread before the statements are cleared
     m_worker.reset();
     m_stmts.clear();
+    m_batchedStmts.clear();
 
     if (m_Mysql)
     {
@@ -398,8 +405,11 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
 
     BeginTransaction();
 
-    for (auto const& data : queries)
+    std::vector<PreparedStatementBase*> batch;
+
+    for (std::size_t i = 0; i < queries.size(); ++i)
     {
+        SQLElementData const& data = queries[i];
         switch (data.type)
         {
             case SQL_ELEMENT_PREPARED:
@@ -418,12 +428,57 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
 
                 ASSERT(stmt);
 
-                if (!Execute(stmt))
+                auto batchItr = m_batchedStmts.find(stmt->GetIndex());
+                if (batchItr == m_batchedStmts.end())
                 {
-                    LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
-                    int errorCode = GetLastError();
-                    RollbackTransaction();
-                    return errorCode;
+                    if (!Execute(stmt))
+                    {
+                        LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
+                        int errorCode = GetLastError();
+                        RollbackTransaction();
+                        return errorCode;
+                    }
+
+                    break;
+                }
+
+                // Collect the run of consecutive executions of this statement, order inside the transaction is preserved
+                batch.clear();
+                batch.push_back(stmt);
+
+                while (i + 1 < queries.size() && queries[i + 1].type == SQL_ELEMENT_PREPARED)
+                {
+                    PreparedStatementBase* next = std::get<PreparedStatementBase*>(queries[i + 1].element);
+                    if (next->GetIndex() != stmt->GetIndex())
+                        break;
+
+                    batch.push_back(next);
+                    ++i;
+                }
+
+                // Execute the run in power of two chunks so only a handful of statements per index ever get prepared
+                std::size_t offset = 0;
+                while (offset < batch.size())
+                {
+                    std::size_t rows = std::min<std::size_t>(batch.size() - offset, batchItr->second.maxRows);
+                    while (rows & (rows - 1))
+                        rows &= rows - 1;
+
+                    bool success;
+                    if (rows == 1)
+                        success = Execute(batch[offset]);
+                    else
+                        success = ExecuteBatch(std::vector<PreparedStatementBase*>(batch.begin() + offset, batch.begin() + offset + rows));
+
+                    if (!success)
+                    {
+                        LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
+                        int errorCode = GetLastError();
+                        RollbackTransaction();
+                        return errorCode;
+                    }
+
+                    offset += rows;
                 }
             }
             break;
@@ -545,6 +600,173 @@ void MySQLConnection::PrepareStatement(uint32 index, std::string_view sql, Conne
     }
 }
 
+void MySQLConnection::EnableStatementBatching(uint32 index)
+{
+    // Statement was not prepared on this connection type
+    if (!m_stmts[index])
+    {
+        m_batchedStmts.erase(index);
+        return;
+    }
+
+    std::string const& sql = m_stmts[index]->m_queryString;
+
+    auto startsWith = [&sql](std::string_view prefix)
+    {
+        return sql.size() >= prefix.size() && std::equal(prefix.begin(), prefix.end(), sql.begin(),
+            [](char a, char b) { return std::toupper(static_cast<unsigned char>(a)) == std::toupper(static_cast<unsigned char>(b)); });
+    };
+
+    if (!startsWith("INSERT") && !startsWith("REPLACE"))
+    {
+        LOG_ERROR("sql.sql", "Statement {} can not be batched, only INSERT and REPLACE statements are supported: \"{}\"", index, sql);
+        return;
+    }
+
+    std::string upper(sql);
+    std::transform(upper.begin(), upper.end(), upper.begin(), [](unsigned char c) { return std::toupper(c); });
+
+    std::size_t const valuesPos = upper.find("VALUES");
+    std::size_t const rowStart = valuesPos != std::string::npos ? sql.find('(', valuesPos) : std::string::npos;
+    std::size_t rowEnd = std::string::npos;
+
+    if (rowStart != std::string::npos)
+    {
+        uint32 depth = 0;
+        for (std::size_t pos = rowStart; pos < sql.size(); ++pos)
+        {
+            if (sql[pos] == '(')
+                ++depth;
+            else if (sql[pos] == ')' && !--depth)
+            {
+                rowEnd = pos;
+                break;
+            }
+        }
+    }
+
+    // Parameters past the row template would be bound out of order
+    if (rowEnd == std::string::npos || sql.find('?', rowEnd) != std::string::npos)
+    {
+        LOG_ERROR("sql.sql", "Statement {} can not be batched, could not find a single VALUES row template: \"{}\"", index, sql);
+        return;
+    }
+
+    uint32 const paramCount = m_stmts[index]->GetParameterCount();
+
+    // Parameter positions are bound as uint8
+    uint32 maxRows = MAX_BATCHED_ROWS;
+    while (maxRows > 1 && maxRows * paramCount > std::numeric_limits<uint8>::max())
+        maxRows >>= 1;
+
+    BatchedStatementInfo& info = m_batchedStmts[index];
+    info.head = sql.substr(0, rowStart);
+    info.row = sql.substr(rowStart, rowEnd - rowStart + 1);
+    info.tail = sql.substr(rowEnd + 1);
+    info.maxRows = maxRows;
+    info.stmts.clear();
+}
+
+MySQLPreparedStatement* MySQLConnection::GetBatchedStatement(uint32 index, uint32 rows)
+{
+    BatchedStatementInfo& info = m_batchedStmts.at(index);
+
+    std::unique_ptr<MySQLPreparedStatement>& batched = info.stmts[rows];
+    if (batched)
+        return batched.get();
+
+    std::string sql = info.head;
+    for (uint32 row = 0; row < rows; ++row)
+    {
+        if (row)
+            sql += ", ";
+
+        sql += info.row;
+    }
+
+    sql += info.tail;
+
+    MYSQL_STMT* stmt = mysql_stmt_init(m_Mysql);
+    if (!stmt)
+    {
+        LOG_ERROR("sql.sql", "In mysql_stmt_init() id: {} ({} rows), sql: \"{}\"", index, rows, sql);
+        LOG_ERROR("sql.sql", "{}", mysql_error(m_Mysql));
+        return nullptr;
+    }
+
+    if (mysql_stmt_prepare(stmt, sql.c_str(), static_cast<unsigned long>(sql.size())))
+    {
+        LOG_ERROR("sql.sql", "In mysql_stmt_prepare() id: {} ({} rows), sql: \"{}\"", index, rows, sql);
+        LOG_ERROR("sql.sql", "{}", mysql_stmt_error(stmt));
+        mysql_stmt_close(stmt);
+        return nullptr;
+    }
+
+    batched = std::make_unique<MySQLPreparedStatement>(reinterpret_cast<MySQLStmt*>(stmt), sql);
+    return batched.get();
+}
+
+bool MySQLConnection::ExecuteBatch(std::vector<PreparedStatementBase*> const& stmts)
+{
+    if (!m_Mysql)
+        return false;
+
+    uint32 index = stmts.front()->GetIndex();
+
+    MySQLPreparedStatement* m_mStmt = GetBatchedStatement(index, uint32(stmts.size()));
+    if (!m_mStmt)
+    {
+        // Could not prepare the multi-row form, fall back to one round trip per row
+        for (PreparedStatementBase* stmt : stmts)
+            if (!Execute(stmt))
+                return false;
+
+        return true;
+    }
+
+    m_mStmt->BindParameters(stmts);
+
+    MYSQL_STMT* msql_STMT = m_mStmt->GetSTMT();
+    MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
+
+    uint32 _s = getMSTime();
+
+#if !defined(MARIADB_VERSION_ID) && (MYSQL_VERSION_ID >= 80300)
+    if (mysql_stmt_bind_named_param(msql_STMT, msql_BIND, m_mStmt->GetParameterCount(), nullptr))
+#else
+    if (mysql_stmt_bind_param(msql_STMT, msql_BIND))
+#endif
+    {
+        uint32 lErrno = mysql_errno(m_Mysql);
+        LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
+
+        m_mStmt->ClearParameters();
+
+        if (_HandleMySQLErrno(lErrno))  // If it returns true, an error was handled successfully (i.e. reconnection)
+            return ExecuteBatch(stmts); // Try again
+
+        return false;
+    }
+
+    if (mysql_stmt_execute(msql_STMT))
+    {
+        uint32 lErrno = mysql_errno(m_Mysql);
+        LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
+
+        m_mStmt->ClearParameters();
+
+        if (_HandleMySQLErrno(lErrno))  // If it returns true, an error was handled successfully (i.e. reconnection)
+            return ExecuteBatch(stmts); // Try again
+
+        return false;
+    }
+
+    LOG_DEBUG("sql.sql", "[{} ms] SQL(p) x{}: {}", getMSTimeDiff(_s, getMSTime()), stmts.size(), m_mStmt->getQueryString());
+
+    m_mStmt->ClearParameters();
+    return true;
+}
+
 PreparedResultSet* MySQLConnection::Query(PreparedStatementBase* stmt)
 {
     MySQLPreparedStatement* mysqlStmt = nullptr;
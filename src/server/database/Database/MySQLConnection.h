@@ -24,14 +24,13 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
-template <typename T>
-class ProducerConsumerQueue;
-
 class DatabaseWorker;
 class MySQLPreparedStatement;
 class SQLOperation;
+class SQLOperationQueue;
 
 enum ConnectionFlags
 {
@@ -61,7 +60,7 @@ friend class PingOperation;
 
 public:
     MySQLConnection(MySQLConnectionInfo& connInfo);                               //! Constructor for synchronous connections.
-    MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo);  //! Constructor for asynchronous connections.
+    MySQLConnection(SQLOperationQueue* queue, MySQLConnectionInfo& connInfo);  //! Constructor for asynchronous connections.
     virtual ~MySQLConnection();
 
     virtual uint32 Open();
@@ -98,6 +97,10 @@ protected:
     MySQLPreparedStatement* GetPreparedStatement(uint32 index);
     void PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags);
 
+    /// Allows consecutive executions of an INSERT/REPLACE statement inside a transaction
+    /// to be coalesced into multi-row statements. Must be called after PrepareStatement.
+    void EnableStatementBatching(uint32 index);
+
     virtual void DoPrepareStatements() = 0;
     virtual bool _HandleMySQLErrno(uint32 errNo, uint8 attempts = 5);
 
@@ -109,7 +112,21 @@ protected:
     MySQLHandle* m_Mysql; //! MySQL Handle.
 
 private:
-    ProducerConsumerQueue<SQLOperation*>* m_queue;      //! Queue shared with other asynchronous connections.
+    struct BatchedStatementInfo
+    {
+        std::string head;       //! "INSERT INTO table (columns) VALUES "
+        std::string row;        //! "(?, ?, ?)"
+        std::string tail;       //! Anything following the row template
+        uint32 maxRows;         //! Widest batch allowed for this statement, always a power of two
+        std::unordered_map<uint32, std::unique_ptr<MySQLPreparedStatement>> stmts; //! Lazily prepared statements, keyed by row count
+    };
+
+    bool ExecuteBatch(std::vector<PreparedStatementBase*> const& stmts);
+    MySQLPreparedStatement* GetBatchedStatement(uint32 index, uint32 rows);
+
+    std::unordered_map<uint32, BatchedStatementInfo> m_batchedStmts; //! Statements eligible for multi-row coalescing
+
+    SQLOperationQueue* m_queue;      //! Queue shared with other asynchronous connections.
     std::unique_ptr<DatabaseWorker> m_worker;           //! Core worker task.
     MySQLConnectionInfo& m_connectionInfo;              //! Connection info (used for logging)
     ConnectionFlags m_connectionFlags;                  //! Connection flags (for preparing relevant statements)
@@ -86,8 +86,37 @@ void MySQLPreparedStatement::BindParameters(PreparedStatementBase* stmt)
 #endif
 }
 
+void MySQLPreparedStatement::BindParameters(std::vector<PreparedStatementBase*> const& stmts)
+{
+    ASSERT(!stmts.empty());
+
+    m_stmt = stmts.front();
+    m_batch = stmts;
+
+    uint8 pos = 0;
+    for (PreparedStatementBase* stmt : stmts)
+    {
+        for (PreparedStatementData const& data : stmt->GetParameters())
+        {
+            std::visit([&](auto&& param)
+            {
+                SetParameter(pos, param);
+            }, data.data);
+
+            ++pos;
+        }
+    }
+
+#ifdef _DEBUG
+    if (pos < m_paramCount)
+        LOG_WARN("sql.sql", "[WARNING]: BindParameters() for batched statement {} did not bind all allocated parameters", m_stmt->GetIndex());
+#endif
+}
+
 void MySQLPreparedStatement::ClearParameters()
 {
+    m_batch.clear();
+
     for (uint32 i=0; i < m_paramCount; ++i)
     {
         delete m_bind[i].length;
@@ -192,18 +221,27 @@ std::string MySQLPreparedStatement::getQueryString() const
 
     std::size_t pos = 0;
 
-    for (PreparedStatementData const& data : m_stmt->GetParameters())
+    auto replaceParameters = [&](PreparedStatementBase const* stmt)
     {
-        pos = queryString.find('?', pos);
-
-        std::string replaceStr = std::visit([&](auto&& data)
+        for (PreparedStatementData const& data : stmt->GetParameters())
         {
-            return PreparedStatementData::ToString(data);
-        }, data.data);
-
-        queryString.replace(pos, 1, replaceStr);
-        pos += replaceStr.length();
-    }
+            pos = queryString.find('?', pos);
+
+            std::string replaceStr = std::visit([&](auto&& data)
+            {
+                return PreparedStatementData::ToString(data);
+            }, data.data);
+
+            queryString.replace(pos, 1, replaceStr);
+            pos += replaceStr.length();
+        }
+    };
+
+    if (m_batch.empty())
+        replaceParameters(m_stmt);
+    else
+        for (PreparedStatementBase const* stmt : m_batch)
+            replaceParameters(stmt);
 
     return queryString;
 }
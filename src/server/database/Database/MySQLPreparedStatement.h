@@ -40,6 +40,9 @@ public:
     ~MySQLPreparedStatement();
 
     void BindParameters(PreparedStatementBase* stmt);
+    //! Binds the parameters of several statements sharing the same index, one row after another.
+    //! Used by multi-row statements built from a single row template.
+    void BindParameters(std::vector<PreparedStatementBase*> const& stmts);
 
     uint32 GetParameterCount() const { return m_paramCount; }
 
@@ -55,6 +58,7 @@ protected:
     MySQLStmt* GetSTMT() { return m_Mstmt; }
     MySQLBind* GetBind() { return m_bind; }
     PreparedStatementBase* m_stmt;
+    std::vector<PreparedStatementBase*> m_batch;
     void ClearParameters();
     void AssertValidIndex(const uint8 index);
     std::string getQueryString() const;
@@ -20,6 +20,7 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "Duration.h"
 #include <variant>
 
 //- Type specifier of our element data
@@ -36,6 +37,18 @@ struct SQLElementData
     SQLElementDataType type;
 };
 
+//- Queue lane of an asynchronous operation, lower values are served first.
+//- Operations in different lanes are not ordered relative to each other, so anything
+//- reading or writing rows that normal priority writes also touch must stay in SQL_PRIORITY_NORMAL.
+enum SQLOperationPriority : uint8
+{
+    SQL_PRIORITY_HIGH,      // Reads a player is waiting on (account lookup on login)
+    SQL_PRIORITY_NORMAL,
+    SQL_PRIORITY_LOW,       // Independent writes nothing reads back (log rows, keep alive pings)
+
+    MAX_SQL_PRIORITY
+};
+
 class MySQLConnection;
 
 class AC_DATABASE_API SQLOperation
@@ -54,6 +67,8 @@ public:
     virtual void SetConnection(MySQLConnection* con) { m_conn = con; }
 
     MySQLConnection* m_conn{nullptr};
+    SQLOperationPriority m_priority{SQL_PRIORITY_NORMAL};
+    TimePoint m_enqueueTime{};
 
 private:
     SQLOperation(SQLOperation const& right) = delete;
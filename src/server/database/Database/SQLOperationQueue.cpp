@@ -0,0 +1,164 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SQLOperationQueue.h"
+#include "Errors.h"
+
+SQLOperationQueue::SQLOperationQueue() :
+    _shutdown(false),
+    _reservedWorkers(0),
+    _registeredHighWorkers(0) { }
+
+SQLOperationQueue::~SQLOperationQueue()
+{
+    Cancel();
+}
+
+void SQLOperationQueue::Push(SQLOperation* operation, SQLOperationPriority priority)
+{
+    ASSERT(priority < MAX_SQL_PRIORITY);
+
+    operation->m_priority = priority;
+    operation->m_enqueueTime = std::chrono::steady_clock::now();
+
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        Lane& lane = _lanes[priority];
+        lane.Operations.push_back(operation);
+        lane.Depth.store(lane.Operations.size(), std::memory_order_relaxed);
+    }
+
+    if (priority == SQL_PRIORITY_HIGH)
+        _highCondition.notify_one();
+
+    _anyCondition.notify_one();
+}
+
+SQLOperation* SQLOperationQueue::WaitAndPop(SQLOperationPriority lowestPriority)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+
+    std::condition_variable& condition = lowestPriority == SQL_PRIORITY_HIGH ? _highCondition : _anyCondition;
+
+    for (;;)
+    {
+        if (_shutdown)
+            return nullptr;
+
+        for (uint8 priority = SQL_PRIORITY_HIGH; priority <= lowestPriority; ++priority)
+            if (!_lanes[priority].Operations.empty())
+                return PopFrom(_lanes[priority]);
+
+        condition.wait(lock);
+    }
+}
+
+SQLOperation* SQLOperationQueue::PopFrom(Lane& lane)
+{
+    SQLOperation* operation = lane.Operations.front();
+    lane.Operations.pop_front();
+    lane.Depth.store(lane.Operations.size(), std::memory_order_relaxed);
+
+    Microseconds const wait = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - operation->m_enqueueTime);
+    ++lane.Processed;
+    lane.TotalWait += wait;
+    if (wait > lane.MaxWait)
+        lane.MaxWait = wait;
+
+    return operation;
+}
+
+void SQLOperationQueue::Cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        for (Lane& lane : _lanes)
+        {
+            for (SQLOperation* operation : lane.Operations)
+                delete operation;
+
+            lane.Operations.clear();
+            lane.Depth.store(0, std::memory_order_relaxed);
+        }
+
+        _shutdown = true;
+    }
+
+    _highCondition.notify_all();
+    _anyCondition.notify_all();
+}
+
+void SQLOperationQueue::Reopen()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    _shutdown = false;
+}
+
+SQLOperationPriority SQLOperationQueue::RegisterWorker()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    // The first reserved workers only serve the high priority lane, at least one worker always serves every lane
+    if (_registeredHighWorkers < _reservedWorkers)
+    {
+        ++_registeredHighWorkers;
+        return SQL_PRIORITY_HIGH;
+    }
+
+    return SQLOperationPriority(MAX_SQL_PRIORITY - 1);
+}
+
+void SQLOperationQueue::UnregisterWorker(SQLOperationPriority lowestPriority)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    if (lowestPriority == SQL_PRIORITY_HIGH && _registeredHighWorkers)
+        --_registeredHighWorkers;
+}
+
+std::size_t SQLOperationQueue::Size() const
+{
+    std::size_t size = 0;
+    for (Lane const& lane : _lanes)
+        size += lane.Depth.load(std::memory_order_relaxed);
+
+    return size;
+}
+
+SQLQueueLaneStats SQLOperationQueue::GetStats(SQLOperationPriority priority) const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    Lane const& lane = _lanes[priority];
+
+    SQLQueueLaneStats stats;
+    stats.Depth = lane.Operations.size();
+    stats.Processed = lane.Processed;
+    stats.TotalWait = lane.TotalWait;
+    stats.MaxWait = lane.MaxWait;
+    return stats;
+}
+
+void SQLOperationQueue::ResetMaxWait()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    for (Lane& lane : _lanes)
+        lane.MaxWait = Microseconds::zero();
+}
@@ -0,0 +1,100 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SQLOPERATIONQUEUE_H
+#define _SQLOPERATIONQUEUE_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "SQLOperation.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+struct SQLQueueLaneStats
+{
+    std::size_t Depth = 0;      //! Operations currently waiting in the lane
+    uint64 Processed = 0;       //! Operations popped from the lane since startup
+    Microseconds TotalWait{};   //! Sum of time spent queued by processed operations
+    Microseconds MaxWait{};     //! Longest time spent queued since the last ResetMaxWait()
+
+    [[nodiscard]] Microseconds GetAverageWait() const { return Processed ? Microseconds(TotalWait.count() / int64(Processed)) : Microseconds::zero(); }
+};
+
+/*! Queue shared by the asynchronous connections of a DatabaseWorkerPool.
+    Operations are split in priority lanes, workers always drain the highest
+    priority lane first. A number of workers can be reserved for SQL_PRIORITY_HIGH
+    so a burst of low priority writes never delays a query a player waits on. */
+class AC_DATABASE_API SQLOperationQueue
+{
+public:
+    SQLOperationQueue();
+    ~SQLOperationQueue();
+
+    void Push(SQLOperation* operation, SQLOperationPriority priority);
+
+    //! Blocks until an operation in a lane up to lowestPriority is available.
+    //! Returns nullptr once the queue is cancelled.
+    SQLOperation* WaitAndPop(SQLOperationPriority lowestPriority);
+
+    //! Deletes every queued operation and wakes up all workers.
+    void Cancel();
+
+    //! Accepts workers again after Cancel(), called when the pool opens its connections.
+    void Reopen();
+
+    //! Number of workers that will only serve SQL_PRIORITY_HIGH. Must be set before workers register.
+    void SetReservedWorkers(uint8 count) { _reservedWorkers = count; }
+
+    //! Called once per worker, returns the lowest priority lane it is allowed to serve.
+    SQLOperationPriority RegisterWorker();
+    //! Called when a worker stops, frees its reserved slot so a reopened pool reserves the same number of workers.
+    void UnregisterWorker(SQLOperationPriority lowestPriority);
+
+    [[nodiscard]] std::size_t Size() const;
+    [[nodiscard]] std::size_t Size(SQLOperationPriority priority) const { return _lanes[priority].Depth.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] SQLQueueLaneStats GetStats(SQLOperationPriority priority) const;
+    void ResetMaxWait();
+
+private:
+    struct Lane
+    {
+        std::deque<SQLOperation*> Operations;
+        std::atomic<std::size_t> Depth{0};
+        uint64 Processed{0};
+        Microseconds TotalWait{};
+        Microseconds MaxWait{};
+    };
+
+    SQLOperation* PopFrom(Lane& lane);
+
+    mutable std::mutex _lock;
+    std::condition_variable _highCondition; //! Reserved workers wait here
+    std::condition_variable _anyCondition;  //! Workers serving all lanes wait here
+    std::array<Lane, MAX_SQL_PRIORITY> _lanes;
+    bool _shutdown;
+    uint8 _reservedWorkers;
+    uint8 _registeredHighWorkers;
+
+    SQLOperationQueue(SQLOperationQueue const& right) = delete;
+    SQLOperationQueue& operator=(SQLOperationQueue const& right) = delete;
+};
+
+#endif
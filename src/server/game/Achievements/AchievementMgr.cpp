@@ -482,6 +482,8 @@ AchievementMgr::AchievementMgr(Player* player)
 {
     m_player = player;
     _offlineUpdatesDelayTimer = 0;
+    _openCriteriaDirty = false;
+    _criteriaUpdateDepth = 0;
 }
 
 AchievementMgr::~AchievementMgr()
@@ -506,6 +508,7 @@ void AchievementMgr::Reset()
 
     _completedAchievements.clear();
     _criteriaProgress.clear();
+    _openCriteriaDirty = true;
     DeleteFromDB(m_player->GetGUID().GetCounter());
 
     // re-fill data
@@ -562,7 +565,8 @@ void AchievementMgr::SaveToDB(CharacterDatabaseTransaction trans)
 {
     if (!_completedAchievements.empty())
     {
-        for (CompletedAchievementMap::iterator iter = _completedAchievements.begin(); iter != _completedAchievements.end(); ++iter)
+        // Deletes are appended first, so the inserts below form a single run that can be batched
+        for (CompletedAchievementMap::const_iterator iter = _completedAchievements.begin(); iter != _completedAchievements.end(); ++iter)
         {
             if (!iter->second.changed)
                 continue;
@@ -571,8 +575,14 @@ void AchievementMgr::SaveToDB(CharacterDatabaseTransaction trans)
             stmt->SetData(0, iter->first);
             stmt->SetData(1, GetPlayer()->GetGUID().GetCounter());
             trans->Append(stmt);
+        }
+
+        for (CompletedAchievementMap::iterator iter = _completedAchievements.begin(); iter != _completedAchievements.end(); ++iter)
+        {
+            if (!iter->second.changed)
+                continue;
 
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_ACHIEVEMENT);
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_ACHIEVEMENT);
             stmt->SetData(0, GetPlayer()->GetGUID().GetCounter());
             stmt->SetData(1, iter->first);
             stmt->SetData(2, uint32(iter->second.date));
@@ -586,7 +596,7 @@ void AchievementMgr::SaveToDB(CharacterDatabaseTransaction trans)
 
     if (!_criteriaProgress.empty())
     {
-        for (CriteriaProgressMap::iterator iter = _criteriaProgress.begin(); iter != _criteriaProgress.end(); ++iter)
+        for (CriteriaProgressMap::const_iterator iter = _criteriaProgress.begin(); iter != _criteriaProgress.end(); ++iter)
         {
             if (!iter->second.changed)
                 continue;
@@ -595,11 +605,17 @@ void AchievementMgr::SaveToDB(CharacterDatabaseTransaction trans)
             stmt->SetData(0, GetPlayer()->GetGUID().GetCounter());
             stmt->SetData(1, iter->first);
             trans->Append(stmt);
+        }
+
+        for (CriteriaProgressMap::iterator iter = _criteriaProgress.begin(); iter != _criteriaProgress.end(); ++iter)
+        {
+            if (!iter->second.changed)
+                continue;
 
             // pussywizard: insert only for (counter != 0) is very important! this is how criteria of completed achievements gets deleted from db (by setting counter to 0); if conflicted during merge - contact me
             if (iter->second.counter)
             {
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS);
+                CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS);
                 stmt->SetData(0, GetPlayer()->GetGUID().GetCounter());
                 stmt->SetData(1, iter->first);
                 stmt->SetData(2, iter->second.counter);
@@ -631,6 +647,7 @@ void AchievementMgr::LoadFromDB(PreparedQueryResult achievementResult, PreparedQ
             CompletedAchievementData& ca = _completedAchievements[achievementid];
             ca.date = time_t(fields[1].Get<uint32>());
             ca.changed = false;
+            _openCriteriaDirty = true;
 
             // title achievement rewards are retroactive
             if (AchievementReward const* reward = sAchievementMgr->GetAchievementReward(achievement))
@@ -892,9 +909,9 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
 
     sScriptMgr->OnBeforeCheckCriteria(this, achievementCriteriaList);
 
-    for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList->begin(); i != achievementCriteriaList->end(); ++i)
+    ++_criteriaUpdateDepth;
+    for (AchievementCriteriaEntry const* achievementCriteria : GetOpenCriteria(achievementCriteriaList))
     {
-        AchievementCriteriaEntry const* achievementCriteria = (*i);
         AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->referredAchievement);
         if (!achievement)
             continue;
@@ -1818,6 +1835,50 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
                 if (IsCompletedAchievement(*itr))
                     CompletedAchievement(*itr);
     }
+    --_criteriaUpdateDepth;
+}
+
+std::vector<AchievementCriteriaEntry const*> const& AchievementMgr::GetOpenCriteria(AchievementCriteriaEntryList const* criteriaList)
+{
+    // lists still iterated by an outer UpdateAchievementCriteria call are only dropped once it is done
+    if (_openCriteriaDirty && !_criteriaUpdateDepth)
+    {
+        _openCriteria.clear();
+        _openCriteriaDirty = false;
+    }
+
+    auto [itr, inserted] = _openCriteria.try_emplace(criteriaList);
+    if (inserted)
+    {
+        itr->second.reserve(criteriaList->size());
+        for (AchievementCriteriaEntry const* criteria : *criteriaList)
+            if (!IsPermanentlyCompletedCriteria(criteria))
+                itr->second.push_back(criteria);
+    }
+
+    return itr->second;
+}
+
+// Subset of IsCompletedCriteria that can never revert: the achievement and every achievement referencing it are earned.
+// Counters and realm firsts are never considered complete there, so they always stay open.
+bool AchievementMgr::IsPermanentlyCompletedCriteria(AchievementCriteriaEntry const* criteria) const
+{
+    AchievementEntry const* achievement = sAchievementStore.LookupEntry(criteria->referredAchievement);
+    if (!achievement)
+        return true;
+
+    if (achievement->flags & (ACHIEVEMENT_FLAG_COUNTER | ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL))
+        return false;
+
+    if (!HasAchieved(achievement->ID))
+        return false;
+
+    if (AchievementEntryList const* achRefList = sAchievementMgr->GetAchievementByReferencedId(achievement->ID))
+        for (AchievementEntryList::const_iterator itr = achRefList->begin(); itr != achRefList->end(); ++itr)
+            if (!HasAchieved((*itr)->ID))
+                return false;
+
+    return true;
 }
 
 bool AchievementMgr::IsCompletedCriteria(AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement)
@@ -2289,6 +2350,7 @@ void AchievementMgr::CompletedAchievement(AchievementEntry const* achievement)
 
     SendAchievementEarned(achievement);
     CompletedAchievementData& ca = _completedAchievements[achievement->ID];
+    _openCriteriaDirty = true;
     ca.date = GameTime::GetGameTime().count();
     ca.changed = true;
 
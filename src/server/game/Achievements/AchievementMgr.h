@@ -26,6 +26,8 @@
 #include <chrono>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
 typedef std::list<AchievementEntry const*>         AchievementEntryList;
@@ -328,6 +330,10 @@ private:
     bool CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement);
     void BuildAllDataPacket(WDataStore* data) const;
 
+    // criteria of a global criteria list which may still progress for this player
+    std::vector<AchievementCriteriaEntry const*> const& GetOpenCriteria(AchievementCriteriaEntryList const* criteriaList);
+    [[nodiscard]] bool IsPermanentlyCompletedCriteria(AchievementCriteriaEntry const* criteria) const;
+
     void UpdateTimedAchievements(uint32 timeDiff);
 
     // Handles updates when character was offline.
@@ -340,6 +346,12 @@ private:
     typedef std::map<uint32, uint32> TimedAchievementMap;
     TimedAchievementMap _timedAchievements;      // Criteria id/time left in MS
 
+    // Global criteria lists filtered down to the criteria of achievements not yet finished for good,
+    // built on first use and dropped whenever an achievement is completed or reset
+    std::unordered_map<AchievementCriteriaEntryList const*, std::vector<AchievementCriteriaEntry const*>> _openCriteria;
+    bool _openCriteriaDirty;
+    uint32 _criteriaUpdateDepth;                 // nested UpdateAchievementCriteria calls still iterating _openCriteria
+
     // Offline updates cannot be processed while players are loading,
     // as the player will not be notified of the changes.
     // To ensure proper notification, introduce a delay before processing.
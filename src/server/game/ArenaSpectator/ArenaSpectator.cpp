@@ -224,6 +224,47 @@ void ArenaSpectator::CreatePacket(WDataStore& data, std::string const& message)
     data << uint8(0);
 }
 
+template<>
+AC_GAME_API void ArenaSpectator::SendPacketTo(Player const* player, std::string&& message)
+{
+    WDataStore data;
+    CreatePacket(data, message);
+    player->User()->Send(&data);
+}
+
+template<>
+AC_GAME_API void ArenaSpectator::SendCommandTo(Player* player, WOWGUID /*targetGUID*/, char const* /*key*/, std::string&& message)
+{
+    SendPacketTo<Player>(player, std::move(message));
+}
+
+template<>
+AC_GAME_API void ArenaSpectator::SendCommandTo(Map* map, WOWGUID targetGUID, char const* key, std::string&& message)
+{
+    if (!map->IsBattleArena())
+        return;
+
+    Battleground* bg = ((BattlegroundMap*)map)->GetBG();
+    if (!bg || bg->GetStatus() != STATUS_IN_PROGRESS)
+        return;
+
+    // encoded and sent to the spectators at the next Battleground::Update
+    bg->GetSpectatorStream().Queue(targetGUID, key, std::move(message));
+}
+
+template<>
+AC_GAME_API void ArenaSpectator::SendCommandTo(SpectatorPacketList* packets, WOWGUID /*targetGUID*/, char const* /*key*/, std::string&& message)
+{
+    packets->emplace_back();
+    CreatePacket(packets->back(), message);
+}
+
+template<>
+AC_GAME_API void ArenaSpectator::SendPacketTo(const Map* map, std::string&& message)
+{
+    SendCommandTo(const_cast<Map*>(map), WOWGUID::Empty, nullptr, std::move(message));
+}
+
 void ArenaSpectator::HandleResetCommand(Player* player)
 {
     if (!player->FindMap() || !player->IsInWorld() || !player->FindMap()->IsBattleArena())
@@ -239,44 +280,59 @@ void ArenaSpectator::HandleResetCommand(Player* player)
         if (player->HasReceivedSpectatorResetFor(itr->first))
             continue;
 
-        Player* plr = itr->second;
         player->AddReceivedSpectatorResetFor(itr->first);
 
-        SendCommand_String(player, itr->first, "NME", plr->GetName().c_str());
-        // Xinef: addon compatibility
-        SendCommand_UInt32Value(player, itr->first, "TEM", plr->GetBgTeamId() == TEAM_ALLIANCE ? ALLIANCE : HORDE);
-        SendCommand_UInt32Value(player, itr->first, "CLA", plr->GetClass());
-        SendCommand_UInt32Value(player, itr->first, "MHP", plr->GetMaxHealth());
-        SendCommand_UInt32Value(player, itr->first, "CHP", plr->GetHealth());
-        SendCommand_UInt32Value(player, itr->first, "STA", plr->IsAlive() ? 1 : 0);
-        POWER_TYPE ptype = plr->GetPowerType();
-        SendCommand_UInt32Value(player, itr->first, "PWT", ptype);
-        SendCommand_UInt32Value(player, itr->first, "MPW", ptype == POWER_TYPE_RAGE || ptype == POWER_TYPE_RUNIC_POWER ? plr->GetMaxPower(ptype) / 10 : plr->GetMaxPower(ptype));
-        SendCommand_UInt32Value(player, itr->first, "CPW", ptype == POWER_TYPE_RAGE || ptype == POWER_TYPE_RUNIC_POWER ? plr->GetPower(ptype) / 10 : plr->GetPower(ptype));
-        Pet* pet = plr->GetPet();
-        SendCommand_UInt32Value(player, itr->first, "PHP", pet && pet->GetCreatureTemplate()->family ? (uint32)pet->GetHealthPct() : 0);
-        SendCommand_UInt32Value(player, itr->first, "PET", pet ? pet->GetCreatureTemplate()->family : 0);
-        SendCommand_GUID(player, itr->first, "TRG", plr->GetTarget());
-        SendCommand_UInt32Value(player, itr->first, "RES", 1);
-        SendCommand_UInt32Value(player, itr->first, "CDC", 1);
-        SendCommand_UInt32Value(player, itr->first, "TIM", (bg->GetStartTime() < 46 * MINUTE * IN_MILLISECONDS) ? (46 * MINUTE * IN_MILLISECONDS - bg->GetStartTime()) / IN_MILLISECONDS : 0);
-        // "SPE" not here (only possible to send starting a new cast)
-
-        // send all "CD"
-        SpellCooldowns const& sc = plr->GetSpellCooldownMap();
-        for (SpellCooldowns::const_iterator itrc = sc.begin(); itrc != sc.end(); ++itrc)
-            if (itrc->second.sendToSpectator && itrc->second.maxduration >= SPECTATOR_COOLDOWN_MIN * IN_MILLISECONDS && itrc->second.maxduration <= SPECTATOR_COOLDOWN_MAX * IN_MILLISECONDS)
-                if (uint32 cd = (getMSTimeDiff(getMSTime(), itrc->second.end) / 1000))
-                    SendCommand_Cooldown(player, itr->first, "ACD", itrc->first, cd, itrc->second.maxduration / 1000);
-
-        // send all visible "AUR"
-        Unit::VisibleAuraMap const* visibleAuras = plr->GetVisibleAuras();
-        for (Unit::VisibleAuraMap::const_iterator aitr = visibleAuras->begin(); aitr != visibleAuras->end(); ++aitr)
+        // the snapshot of a participant is the same for every spectator asking for it during this update
+        ArenaSpectatorStream& stream = bg->GetSpectatorStream();
+        SpectatorPacketList const* snapshot = stream.GetSnapshot(itr->first);
+        if (!snapshot)
         {
-            Aura* aura = aitr->second->GetBase();
-            if (ShouldSendAura(aura, aitr->second->GetEffectMask(), plr->GetGUID(), false))
-                SendCommand_Aura(player, itr->first, "AUR", aura->GetCasterGUID(), aura->GetSpellInfo()->Id, aura->GetSpellInfo()->IsPositive(), aura->GetSpellInfo()->Dispel, aura->GetDuration(), aura->GetMaxDuration(), (aura->GetCharges() > 1 ? aura->GetCharges() : aura->GetStackAmount()), false);
+            SpectatorPacketList& packets = stream.AddSnapshot(itr->first);
+            BuildSnapshot(&packets, bg, itr->second);
+            snapshot = &packets;
         }
+
+        for (WDataStore const& packet : *snapshot)
+            player->User()->Send(&packet);
+    }
+}
+
+void ArenaSpectator::BuildSnapshot(SpectatorPacketList* packets, Battleground* bg, Player* plr)
+{
+    SendCommand_String(packets, plr->GetGUID(), "NME", plr->GetName().c_str());
+    // Xinef: addon compatibility
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "TEM", plr->GetBgTeamId() == TEAM_ALLIANCE ? ALLIANCE : HORDE);
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "CLA", plr->GetClass());
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "MHP", plr->GetMaxHealth());
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "CHP", plr->GetHealth());
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "STA", plr->IsAlive() ? 1 : 0);
+    POWER_TYPE ptype = plr->GetPowerType();
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "PWT", ptype);
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "MPW", ptype == POWER_TYPE_RAGE || ptype == POWER_TYPE_RUNIC_POWER ? plr->GetMaxPower(ptype) / 10 : plr->GetMaxPower(ptype));
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "CPW", ptype == POWER_TYPE_RAGE || ptype == POWER_TYPE_RUNIC_POWER ? plr->GetPower(ptype) / 10 : plr->GetPower(ptype));
+    Pet* pet = plr->GetPet();
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "PHP", pet && pet->GetCreatureTemplate()->family ? (uint32)pet->GetHealthPct() : 0);
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "PET", pet ? pet->GetCreatureTemplate()->family : 0);
+    SendCommand_GUID(packets, plr->GetGUID(), "TRG", plr->GetTarget());
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "RES", 1);
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "CDC", 1);
+    SendCommand_UInt32Value(packets, plr->GetGUID(), "TIM", (bg->GetStartTime() < 46 * MINUTE * IN_MILLISECONDS) ? (46 * MINUTE * IN_MILLISECONDS - bg->GetStartTime()) / IN_MILLISECONDS : 0);
+    // "SPE" not here (only possible to send starting a new cast)
+
+    // send all "CD"
+    SpellCooldowns const& sc = plr->GetSpellCooldownMap();
+    for (SpellCooldowns::const_iterator itrc = sc.begin(); itrc != sc.end(); ++itrc)
+        if (itrc->second.sendToSpectator && itrc->second.maxduration >= SPECTATOR_COOLDOWN_MIN * IN_MILLISECONDS && itrc->second.maxduration <= SPECTATOR_COOLDOWN_MAX * IN_MILLISECONDS)
+            if (uint32 cd = (getMSTimeDiff(getMSTime(), itrc->second.end) / 1000))
+                SendCommand_Cooldown(packets, plr->GetGUID(), "ACD", itrc->first, cd, itrc->second.maxduration / 1000);
+
+    // send all visible "AUR"
+    Unit::VisibleAuraMap const* visibleAuras = plr->GetVisibleAuras();
+    for (Unit::VisibleAuraMap::const_iterator aitr = visibleAuras->begin(); aitr != visibleAuras->end(); ++aitr)
+    {
+        Aura* aura = aitr->second->GetBase();
+        if (ShouldSendAura(aura, aitr->second->GetEffectMask(), plr->GetGUID(), false))
+            SendCommand_Aura(packets, plr->GetGUID(), "AUR", aura->GetCasterGUID(), aura->GetSpellInfo()->Id, aura->GetSpellInfo()->IsPositive(), aura->GetSpellInfo()->Dispel, aura->GetDuration(), aura->GetMaxDuration(), (aura->GetCharges() > 1 ? aura->GetCharges() : aura->GetStackAmount()), false);
     }
 }
 
@@ -300,26 +356,3 @@ bool ArenaSpectator::ShouldSendAura(Aura* aura, uint8 effMask, WOWGUID targetGUI
     }
     return false;
 }
-
-template<>
-AC_GAME_API void ArenaSpectator::SendPacketTo(Player const* player, std::string&& message)
-{
-    WDataStore data;
-    CreatePacket(data, message);
-    player->User()->Send(&data);
-}
-
-template<>
-AC_GAME_API void ArenaSpectator::SendPacketTo(const Map* map, std::string&& message)
-{
-    if (!map->IsBattleArena())
-        return;
-
-    Battleground* bg = ((BattlegroundMap*)map)->GetBG();
-    if (!bg || bg->GetStatus() != STATUS_IN_PROGRESS)
-        return;
-
-    WDataStore data;
-    CreatePacket(data, message);
-    bg->SpectatorsSendPacket(data);
-}
@@ -18,6 +18,7 @@
 #ifndef AZEROTHCORE_ARENASPECTATOR_H
 #define AZEROTHCORE_ARENASPECTATOR_H
 
+#include "ArenaSpectatorStream.h"
 #include "Chat.h"
 #include "Common.h"
 #include "ObjectDefines.h"
@@ -26,6 +27,7 @@
 #include "StringFormat.h"
 
 class Aura;
+class Battleground;
 class Player;
 class Map;
 class WDataStore;
@@ -43,6 +45,10 @@ namespace ArenaSpectator
     template<class T>
     AC_GAME_API void SendPacketTo(const T* object, std::string&& message);
 
+    // commands about a participant, sent to a player, queued to the spectator stream of an arena map or added to a snapshot
+    template<class T>
+    AC_GAME_API void SendCommandTo(T* object, WOWGUID targetGUID, char const* key, std::string&& message);
+
     template<class T, typename Format, typename... Args>
     inline void SendCommand(T* o, Format&& fmt, Args&& ... args)
     {
@@ -55,7 +61,7 @@ namespace ArenaSpectator
         if (!targetGUID.IsPlayer())
             return;
 
-        SendCommand(o, "%s0x%016llX;%s=%s;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, c);
+        SendCommandTo(o, targetGUID, prefix, Acore::StringFormat("%s0x%016llX;%s=%s;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, c));
     }
 
     template<class T>
@@ -64,7 +70,7 @@ namespace ArenaSpectator
         if (!targetGUID.IsPlayer())
             return;
 
-        SendCommand(o, "%s0x%016llX;%s=%u;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, t);
+        SendCommandTo(o, targetGUID, prefix, Acore::StringFormat("%s0x%016llX;%s=%u;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, t));
     }
 
     template<class T>
@@ -73,7 +79,7 @@ namespace ArenaSpectator
         if (!targetGUID.IsPlayer())
             return;
 
-        SendCommand(o, "%s0x%016llX;%s=0x%016llX;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, t.GetRawValue());
+        SendCommandTo(o, targetGUID, prefix, Acore::StringFormat("%s0x%016llX;%s=0x%016llX;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, t.GetRawValue()));
     }
 
     template<class T>
@@ -82,7 +88,7 @@ namespace ArenaSpectator
         if (!targetGUID.IsPlayer())
             return;
 
-        SendCommand(o, "%s0x%016llX;%s=%u,%i;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, id, casttime);
+        SendCommandTo(o, targetGUID, prefix, Acore::StringFormat("%s0x%016llX;%s=%u,%i;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, id, casttime));
     }
 
     template<class T>
@@ -95,7 +101,7 @@ namespace ArenaSpectator
             if (si->SpellIconID == 1)
                 return;
 
-        SendCommand(o, "%s0x%016llX;%s=%u,%u,%u;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, id, dur, maxdur);
+        SendCommandTo(o, targetGUID, prefix, Acore::StringFormat("%s0x%016llX;%s=%u,%u,%u;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, id, dur, maxdur));
     }
 
     template<class T>
@@ -104,13 +110,14 @@ namespace ArenaSpectator
         if (!targetGUID.IsPlayer())
             return;
 
-        SendCommand(o, "%s0x%016llX;%s=%u,%u,%i,%i,%u,%u,%u,0x%016llX;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, remove ? 1 : 0, stack, dur, maxdur, id, dispel, isDebuff ? 1 : 0, caster.GetRawValue());
+        SendCommandTo(o, targetGUID, prefix, Acore::StringFormat("%s0x%016llX;%s=%u,%u,%i,%i,%u,%u,%u,0x%016llX;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, remove ? 1 : 0, stack, dur, maxdur, id, dispel, isDebuff ? 1 : 0, caster.GetRawValue()));
     }
 
     AC_GAME_API bool HandleSpectatorSpectateCommand(ChatHandler* handler, std::string const& name);
     AC_GAME_API bool HandleSpectatorWatchCommand(ChatHandler* handler, std::string const& name);
     AC_GAME_API void CreatePacket(WDataStore& data, std::string const& message);
     AC_GAME_API void HandleResetCommand(Player* player);
+    AC_GAME_API void BuildSnapshot(SpectatorPacketList* packets, Battleground* bg, Player* player);
     AC_GAME_API bool ShouldSendAura(Aura* aura, uint8 effMask, WOWGUID targetGUID, bool remove);
 }
 
@@ -0,0 +1,132 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ArenaSpectatorStream.h"
+#include "ArenaSpectator.h"
+#include "Player.h"
+#include "World.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace
+{
+    // commands carrying the current value of something, only the latest one matters
+    std::array<char const*, 9> const ValueCommands = { "CHP", "MHP", "CPW", "MPW", "PWT", "PHP", "PET", "STA", "TRG" };
+
+    bool IsValueCommand(char const* key)
+    {
+        return std::any_of(ValueCommands.begin(), ValueCommands.end(), [key](char const* command) { return !std::strcmp(key, command); });
+    }
+
+    uint64 MakeValueKey(WOWGUID targetGUID, char const* key)
+    {
+        uint32 command = 0;
+        for (uint8 i = 0; i < 4 && key[i]; ++i)
+            command |= uint32(uint8(key[i])) << (i * 8);
+
+        return (uint64(targetGUID.GetCounter()) << 32) | command;
+    }
+}
+
+void ArenaSpectatorStream::Queue(WOWGUID targetGUID, char const* key, std::string&& message)
+{
+    if (key && IsValueCommand(key))
+    {
+        auto [itr, inserted] = _valueIndex.try_emplace(MakeValueKey(targetGUID, key), _messages.size());
+        if (!inserted)
+        {
+            // the new value goes to the end, so it still follows the commands queued before it
+            _messages[itr->second].clear();
+            itr->second = _messages.size();
+        }
+    }
+
+    _messages.push_back(std::move(message));
+}
+
+SpectatorPacketList const* ArenaSpectatorStream::GetSnapshot(WOWGUID participantGUID) const
+{
+    auto itr = _snapshots.find(participantGUID);
+    return itr != _snapshots.end() ? &itr->second : nullptr;
+}
+
+SpectatorPacketList& ArenaSpectatorStream::AddSnapshot(WOWGUID participantGUID)
+{
+    SpectatorPacketList& snapshot = _snapshots[participantGUID];
+    snapshot.clear();
+    return snapshot;
+}
+
+void ArenaSpectatorStream::Update(uint32 diff, SpectatorList const& spectators)
+{
+    std::size_t count = 0;
+    if (!spectators.empty())
+    {
+        for (std::string const& message : _messages)
+        {
+            if (message.empty())
+                continue;
+
+            if (_packets.size() <= count)
+                _packets.emplace_back();
+
+            ArenaSpectator::CreatePacket(_packets[count++], message);
+        }
+    }
+
+    _messages.clear();
+    _valueIndex.clear();
+
+    uint32 const packetsPerSecond = sWorld->getIntConfig(CONFIG_ARENA_SPECTATOR_PACKETS_PER_SECOND);
+
+    for (Player* spectator : spectators)
+    {
+        if (packetsPerSecond)
+        {
+            float const maxBudget = float(packetsPerSecond);
+            SpectatorState& state = _spectators.try_emplace(spectator->GetGUID(), SpectatorState{ maxBudget, false }).first->second;
+            state.Budget = std::min(state.Budget + maxBudget * diff / IN_MILLISECONDS, maxBudget);
+
+            if (state.NeedsSnapshot)
+            {
+                if (state.Budget < maxBudget)
+                    continue;
+
+                // the snapshot replaces all the updates skipped so far, this one included
+                state.NeedsSnapshot = false;
+                state.Budget = 0.0f;
+                spectator->ClearReceivedSpectatorResetFor();
+                ArenaSpectator::HandleResetCommand(spectator);
+                continue;
+            }
+
+            if (state.Budget < float(count))
+            {
+                state.NeedsSnapshot = true;
+                continue;
+            }
+
+            state.Budget -= float(count);
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+            spectator->User()->Send(&_packets[i]);
+    }
+
+    _snapshots.clear();
+}
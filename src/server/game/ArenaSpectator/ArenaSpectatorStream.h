@@ -0,0 +1,73 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AZEROTHCORE_ARENASPECTATORSTREAM_H
+#define AZEROTHCORE_ARENASPECTATORSTREAM_H
+
+#include "Define.h"
+#include "GUID.h"
+#include "WDataStore.h"
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Player;
+
+typedef std::vector<WDataStore> SpectatorPacketList;
+
+/**
+ * Addon commands of one arena on their way to its spectators.
+ *
+ * Commands queued during the map update are encoded once into packets shared
+ * by all spectators and sent from Battleground::Update. Until then, a new
+ * value (health, power, target...) of a participant replaces the queued one.
+ *
+ * Every spectator gets a packet budget (Arena.Spectator.PacketsPerSecond).
+ * A spectator that cannot afford an update skips it and gets a fresh snapshot
+ * of the arena once its budget is full again.
+ */
+class AC_GAME_API ArenaSpectatorStream
+{
+public:
+    typedef std::set<Player*> SpectatorList;
+
+    // key is the addon command name, nullptr for commands which must never be merged
+    void Queue(WOWGUID targetGUID, char const* key, std::string&& message);
+
+    // snapshots of the participants, built once per update and shared by all spectators joining meanwhile
+    [[nodiscard]] SpectatorPacketList const* GetSnapshot(WOWGUID participantGUID) const;
+    SpectatorPacketList& AddSnapshot(WOWGUID participantGUID);
+
+    void Update(uint32 diff, SpectatorList const& spectators);
+    void RemoveSpectator(WOWGUID spectatorGUID) { _spectators.erase(spectatorGUID); }
+
+private:
+    struct SpectatorState
+    {
+        float Budget;
+        bool NeedsSnapshot;
+    };
+
+    std::vector<std::string> _messages;                 // merged away values are left empty
+    std::unordered_map<uint64, std::size_t> _valueIndex; // participant and command to index in _messages
+    SpectatorPacketList _packets;                       // reused between updates
+    std::unordered_map<WOWGUID, SpectatorPacketList> _snapshots;
+    std::unordered_map<WOWGUID, SpectatorState> _spectators;
+};
+
+#endif
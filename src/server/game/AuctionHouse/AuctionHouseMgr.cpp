@@ -33,7 +33,7 @@
 constexpr auto AH_MINIMUM_DEPOSIT = 100;
 
 // Proof of concept, we should shift the info we're obtaining in here into AuctionEntry probably
-static bool SortAuction(AuctionEntry* left, AuctionEntry* right, AuctionSortOrderVector& sortOrder, Player* player, bool checkMinBidBuyout)
+static bool SortAuction(AuctionEntry* left, AuctionEntry* right, AuctionSortOrderVector const& sortOrder, Player* player, bool checkMinBidBuyout)
 {
     for (auto& thisOrder : sortOrder)
     {
@@ -639,13 +639,23 @@ void AuctionHouseObject::AddAuction(AuctionEntry* auction)
 {
     ASSERT(auction);
 
-    _auctionsMap[auction->Id] = auction;
+    {
+        std::lock_guard<std::mutex> guard(_searchIndexLock);
+        _auctionsMap[auction->Id] = auction;
+        _searchIndex.Insert(auction);
+    }
+
     sScriptMgr->OnAuctionAdd(this, auction);
 }
 
 bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction)
 {
-    bool wasInMap = !!_auctionsMap.erase(auction->Id);
+    bool wasInMap = false;
+    {
+        std::lock_guard<std::mutex> guard(_searchIndexLock);
+        wasInMap = !!_auctionsMap.erase(auction->Id);
+        _searchIndex.Erase(auction);
+    }
 
     sScriptMgr->OnAuctionRemove(this, auction);
 
@@ -665,6 +675,10 @@ void AuctionHouseObject::Update()
     if (_auctionsMap.empty())
         return;
 
+    // Expiry is deferrable, let the character database queue drain first
+    if (CharacterDatabase.ShouldDefer())
+        return;
+
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
 
     for (AuctionEntryMap::iterator itr, iter = _auctionsMap.begin(); iter != _auctionsMap.end(); )
@@ -738,190 +752,167 @@ bool AuctionHouseObject::BuildListAuctionItems(WDataStore& data, Player* player,
 {
     uint32 itrcounter = 0;
 
-    // Ensures that listfrom is not greater that auctions count
-    listfrom = std::min(listfrom, static_cast<uint32>(GetAuctions().size()));
+    // Copies of the matching auctions, RemoveAuction() may delete the entries on the world thread
+    // once the lock is released, so the sort works on these and the listed page is resolved again below
+    std::vector<AuctionEntry> auctionCopies;
 
-    std::vector<AuctionEntry*> auctionShortlist;
-
-    // pussywizard: optimization, this is a simplified case
-    if (itemClass == 0xffffffff && itemSubClass == 0xffffffff && inventoryType == 0xffffffff && quality == 0xffffffff && levelmin == 0x00 && levelmax == 0x00 && usable == 0x00 && wsearchedname.empty())
     {
-        auto itr = GetAuctionsBegin();
-        for (; itr != GetAuctionsEnd(); ++itr)
-        {
-            auctionShortlist.push_back(itr->second);
-        }
-    }
-    else
-    {
-        auto curTime = GameTime::GetGameTime();
+        std::lock_guard<std::mutex> guard(_searchIndexLock);
 
-        int loc_idx = player->User()->GetSessionDbLocaleIndex();
-        int locdbc_idx = player->User()->GetSessionDbcLocale();
+        // Ensures that listfrom is not greater that auctions count
+        listfrom = std::min(listfrom, static_cast<uint32>(GetAuctions().size()));
 
-        for (AuctionEntryMap::const_iterator itr = _auctionsMap.begin(); itr != _auctionsMap.end(); ++itr)
+        // pussywizard: optimization, this is a simplified case
+        if (itemClass == 0xffffffff && itemSubClass == 0xffffffff && inventoryType == 0xffffffff && quality == 0xffffffff && levelmin == 0x00 && levelmax == 0x00 && usable == 0x00 && wsearchedname.empty())
         {
-            if ((itrcounter++) % 100 == 0) // check condition every 100 iterations
+            auctionCopies.reserve(GetAuctions().size());
+            auto itr = GetAuctionsBegin();
+            for (; itr != GetAuctionsEnd(); ++itr)
             {
-                if (GetMSTimeDiff(GameTime::GetGameTimeMS(), GetTimeMS()) >= searchTimeout) // pussywizard: stop immediately if diff is high or waiting too long
-                {
-                    return false;
-                }
+                auctionCopies.push_back(*itr->second);
             }
+        }
+        else
+        {
+            auto curTime = GameTime::GetGameTime();
 
-            AuctionEntry* Aentry = itr->second;
-            if (!Aentry)
-                return false;
+            LocaleConstant loc_idx = player->User()->GetSessionDbLocaleIndex();
+            LocaleConstant locdbc_idx = player->User()->GetSessionDbcLocale();
 
-            // Skip expired auctions
-            if (Aentry->expire_time < curTime.count())
-            {
-                continue;
-            }
+            // Only the auctions of the requested class and subclass are visited, ordered by id like _auctionsMap.
+            // The other filters are still checked one candidate after another.
+            std::vector<AuctionHouseSearchIndex::Entry const*> candidates;
+            _searchIndex.GetCandidates(itemClass, itemSubClass, candidates);
 
-            Item* item = sAuctionMgr->GetAItem(Aentry->item_guid);
-            if (!item)
-            {
-                continue;
-            }
+            // Result of the name search per name group, every auction of a group shares the same name
+            std::unordered_map<uint64, bool> nameMatches;
 
-            ItemTemplate const* proto = item->GetTemplate();
-            if (itemClass != 0xffffffff && proto->Class != itemClass)
+            for (AuctionHouseSearchIndex::Entry const* entry : candidates)
             {
-                continue;
-            }
+                if ((itrcounter++) % 100 == 0) // check condition every 100 iterations
+                {
+                    if (GetMSTimeDiff(GameTime::GetGameTimeMS(), GetTimeMS()) >= searchTimeout) // pussywizard: stop immediately if diff is high or waiting too long
+                    {
+                        return false;
+                    }
+                }
 
-            if (itemSubClass != 0xffffffff && proto->SubClass != itemSubClass)
-            {
-                continue;
-            }
+                AuctionEntry* Aentry = entry->Auction;
 
-            if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
-            {
-                // xinef: exception, robes are counted as chests
-                if (inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
+                // Skip expired auctions
+                if (Aentry->expire_time < curTime.count())
                 {
                     continue;
                 }
-            }
-
-            if (quality != 0xffffffff && proto->Quality < quality)
-            {
-                continue;
-            }
-
-            if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
-            {
-                continue;
-            }
 
-            if (usable != 0x00)
-            {
-                if (player->CanUseItem(item) != BAG_OK)
+                ItemTemplate const* proto = entry->Proto;
+                if (inventoryType != 0xffffffff && proto->InventoryType != inventoryType)
                 {
-                    continue;
+                    // xinef: exception, robes are counted as chests
+                    if (inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
+                    {
+                        continue;
+                    }
                 }
 
-                // xinef: check already learded recipes and pets
-                if (proto->Spells[1].SpellTrigger == ITEM_SPELLTRIGGER_LEARN_SPELL_ID && player->HasSpell(proto->Spells[1].SpellId))
+                if (quality != 0xffffffff && proto->Quality < quality)
                 {
                     continue;
                 }
-            }
 
-            // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
-            // No need to do any of this if no search term was entered
-            if (!wsearchedname.empty())
-            {
-                std::string name = proto->Name1;
-                if (name.empty())
+                if (levelmin != 0x00 && (proto->RequiredLevel < levelmin || (levelmax != 0x00 && proto->RequiredLevel > levelmax)))
                 {
                     continue;
                 }
 
-                // local name
-                if (loc_idx >= 0)
-                    if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
-                        ObjectMgr::GetLocaleString(il->Name, loc_idx, name);
-
-                // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
-                //  that matches the search but it may not equal item->GetItemRandomPropertyId()
-                //  used in BuildAuctionInfo() which then causes wrong items to be listed
-                int32 propRefID = item->GetItemRandomPropertyId();
-
-                if (propRefID)
+                // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
+                // No need to do any of this if no search term was entered
+                if (!wsearchedname.empty())
                 {
-                    // Append the suffix to the name (ie: of the Monkey) if one exists
-                    // These are found in ItemRandomSuffix.dbc and ItemRandomProperties.dbc
-                    // even though the DBC name seems misleading
-                    std::array<char const*, 16> const* suffix = nullptr;
-
-                    if (propRefID < 0)
-                    {
-                        ItemRandomSuffixEntry const* itemRandEntry = sItemRandomSuffixStore.LookupEntry(-item->GetItemRandomPropertyId());
-                        if (itemRandEntry)
-                            suffix = &itemRandEntry->Name;
-                    }
-                    else
+                    auto [matchItr, inserted] = nameMatches.try_emplace(entry->NameKey, false);
+                    if (inserted)
                     {
-                        ItemRandomPropertiesEntry const* itemRandEntry = sItemRandomPropertiesStore.LookupEntry(item->GetItemRandomPropertyId());
-                        if (itemRandEntry)
-                            suffix = &itemRandEntry->Name;
+                        std::wstring const& name = _searchIndex.GetFoldedName(entry->NameKey, loc_idx, locdbc_idx);
+                        matchItr->second = !name.empty() && name.find(wsearchedname) != std::wstring::npos;
                     }
 
-                    // dbc local name
-                    if (suffix)
+                    if (!matchItr->second)
                     {
-                        // Append the suffix (ie: of the Monkey) to the name using localization
-                        // or default enUS if localization is invalid
-                        name += ' ';
-                        name += (*suffix)[locdbc_idx >= 0 ? locdbc_idx : LOCALE_enUS];
+                        continue;
                     }
                 }
 
-                // Perform the search (with or without suffix)
-                if (!Utf8FitTo(name, wsearchedname))
+                Item* item = sAuctionMgr->GetAItem(Aentry->item_guid);
+                if (!item)
                 {
                     continue;
                 }
-            }
 
-            auctionShortlist.push_back(Aentry);
+                if (usable != 0x00)
+                {
+                    if (player->CanUseItem(item) != BAG_OK)
+                    {
+                        continue;
+                    }
+
+                    // xinef: check already learded recipes and pets
+                    if (proto->Spells[1].SpellTrigger == ITEM_SPELLTRIGGER_LEARN_SPELL_ID && player->HasSpell(proto->Spells[1].SpellId))
+                    {
+                        continue;
+                    }
+                }
+
+                auctionCopies.push_back(*Aentry);
+            }
         }
     }
 
-    if (auctionShortlist.empty())
+    if (auctionCopies.empty())
     {
         return true;
     }
 
+    std::vector<AuctionEntry*> auctionShortlist;
+    auctionShortlist.reserve(auctionCopies.size());
+    for (AuctionEntry& auction : auctionCopies)
+    {
+        auctionShortlist.push_back(&auction);
+    }
+
     // Check if sort enabled, and first sort column is valid, if not don't sort
     if (!sortOrder.empty())
     {
         AuctionSortInfo const& sortInfo = *sortOrder.begin();
         if (sortInfo.sortOrder >= AUCTION_SORT_MINLEVEL && sortInfo.sortOrder < AUCTION_SORT_MAX && sortInfo.sortOrder != AUCTION_SORT_UNK4)
         {
+            bool const isBidSort = sortInfo.sortOrder == AUCTION_SORT_BID;
+            auto sortAuction = [&sortOrder, player, isBidSort](AuctionEntry* left, AuctionEntry* right)
+            {
+                return SortAuction(left, right, sortOrder, player, isBidSort);
+            };
+
             // Partial sort to improve performance a bit, but the last pages will burn
             if (listfrom + 50 <= auctionShortlist.size())
             {
-                std::partial_sort(auctionShortlist.begin(), auctionShortlist.begin() + listfrom + 50, auctionShortlist.end(),
-                    std::bind(SortAuction, std::placeholders::_1, std::placeholders::_2, sortOrder, player, sortInfo.sortOrder == AUCTION_SORT_BID));
+                std::partial_sort(auctionShortlist.begin(), auctionShortlist.begin() + listfrom + 50, auctionShortlist.end(), sortAuction);
             }
             else
             {
-                std::sort(auctionShortlist.begin(), auctionShortlist.end(), std::bind(SortAuction, std::placeholders::_1, std::placeholders::_2, sortOrder,
-                    player, sortInfo.sortOrder == AUCTION_SORT_BID));
+                std::sort(auctionShortlist.begin(), auctionShortlist.end(), sortAuction);
             }
         }
     }
 
-    for (auto& auction : auctionShortlist)
+    // The listed page is built from the live auctions, skipping those removed since they were copied
+    std::lock_guard<std::mutex> guard(_searchIndexLock);
+
+    for (AuctionEntry const* auctionCopy : auctionShortlist)
     {
         // Add the item if no search term or if entered search term was found
         if (count < 50 && totalcount >= listfrom)
         {
-            Item* item = sAuctionMgr->GetAItem(auction->item_guid);
-            if (!item)
+            AuctionEntry const* auction = GetAuction(auctionCopy->Id);
+            if (!auction || !sAuctionMgr->GetAItem(auction->item_guid))
             {
                 continue;
             }
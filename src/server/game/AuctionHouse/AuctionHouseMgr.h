@@ -18,12 +18,14 @@
 #ifndef _AUCTION_HOUSE_MGR_H
 #define _AUCTION_HOUSE_MGR_H
 
+#include "AuctionHouseSearchIndex.h"
 #include "Common.h"
 #include "DBCStructure.h"
 #include "DatabaseEnv.h"
 #include "EventProcessor.h"
 #include "GUID.h"
 #include "WDataStore.h"
+#include <mutex>
 #include <unordered_map>
 
 class Item;
@@ -167,6 +169,10 @@ public:
 private:
     AuctionEntryMap _auctionsMap;
 
+    // lookup structure for BuildListAuctionItems(), which runs on the async listing thread
+    AuctionHouseSearchIndex _searchIndex;
+    std::mutex _searchIndexLock;
+
     // storage for "next" auction item for next Update()
     AuctionEntryMap::const_iterator _next;
 };
@@ -0,0 +1,171 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuctionHouseSearchIndex.h"
+#include "AuctionHouseMgr.h"
+#include "DBCStores.h"
+#include "Item.h"
+#include "ObjectMgr.h"
+#include "Util.h"
+
+void AuctionHouseSearchIndex::Insert(AuctionEntry* auction)
+{
+    ItemTemplate const* proto = sObjectMgr->GetItemTemplate(auction->item_template);
+    if (!proto)
+        return;
+
+    // DO NOT use GetItemEnchantMod(proto->RandomProperty), the listed name must match the suffix sent by BuildAuctionInfo()
+    int32 randomPropertyId = 0;
+    if (Item* item = sAuctionMgr->GetAItem(auction->item_guid))
+        randomPropertyId = item->GetItemRandomPropertyId();
+
+    uint64 const nameKey = (uint64(proto->ItemId) << 32) | uint32(randomPropertyId);
+
+    auto [itr, inserted] = _entries.emplace(auction->Id, Entry{ auction, proto, nameKey });
+    if (!inserted)
+        return;
+
+    _byClass[MakeClassKey(proto->Class, proto->SubClass)].insert(auction->Id);
+
+    NameGroup& group = _nameGroups[nameKey];
+    group.ItemId = proto->ItemId;
+    group.RandomPropertyId = randomPropertyId;
+    ++group.References;
+}
+
+void AuctionHouseSearchIndex::Erase(AuctionEntry const* auction)
+{
+    auto itr = _entries.find(auction->Id);
+    if (itr == _entries.end())
+        return;
+
+    Entry const& entry = itr->second;
+
+    auto classItr = _byClass.find(MakeClassKey(entry.Proto->Class, entry.Proto->SubClass));
+    if (classItr != _byClass.end())
+    {
+        classItr->second.erase(auction->Id);
+        if (classItr->second.empty())
+            _byClass.erase(classItr);
+    }
+
+    auto groupItr = _nameGroups.find(entry.NameKey);
+    if (groupItr != _nameGroups.end() && !--groupItr->second.References)
+        _nameGroups.erase(groupItr);
+
+    _entries.erase(itr);
+}
+
+void AuctionHouseSearchIndex::GetCandidates(uint32 itemClass, uint32 itemSubClass, std::vector<Entry const*>& candidates) const
+{
+    if (itemClass == 0xffffffff)
+    {
+        candidates.reserve(_entries.size());
+        for (auto const& [id, entry] : _entries)
+            candidates.push_back(&entry);
+
+        return;
+    }
+
+    auto addBucket = [&](std::set<uint32> const& auctionIds)
+    {
+        for (uint32 auctionId : auctionIds)
+        {
+            auto itr = _entries.find(auctionId);
+            if (itr != _entries.end())
+                candidates.push_back(&itr->second);
+        }
+    };
+
+    if (itemSubClass != 0xffffffff)
+    {
+        auto itr = _byClass.find(MakeClassKey(itemClass, itemSubClass));
+        if (itr != _byClass.end())
+            addBucket(itr->second);
+
+        return;
+    }
+
+    // Every subclass of the class, buckets are ordered by subclass so restore the auction id order afterwards
+    for (auto itr = _byClass.lower_bound(MakeClassKey(itemClass, 0)); itr != _byClass.end() && (itr->first >> 16) == itemClass; ++itr)
+        addBucket(itr->second);
+
+    std::sort(candidates.begin(), candidates.end(), [](Entry const* left, Entry const* right)
+    {
+        return left->Auction->Id < right->Auction->Id;
+    });
+}
+
+std::wstring const& AuctionHouseSearchIndex::GetFoldedName(uint64 nameKey, LocaleConstant locIdx, LocaleConstant locdbcIdx)
+{
+    static std::wstring const emptyName;
+
+    auto itr = _nameGroups.find(nameKey);
+    if (itr == _nameGroups.end())
+        return emptyName;
+
+    NameGroup& group = itr->second;
+
+    std::optional<std::wstring>& foldedName = group.FoldedNames[locIdx < TOTAL_LOCALES ? locIdx : LOCALE_enUS];
+    if (foldedName)
+        return *foldedName;
+
+    foldedName.emplace();
+
+    ItemTemplate const* proto = sObjectMgr->GetItemTemplate(group.ItemId);
+    if (!proto || proto->Name1.empty())
+        return *foldedName;
+
+    std::string name = proto->Name1;
+
+    // local name
+    if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
+        ObjectMgr::GetLocaleString(il->Name, locIdx, name);
+
+    if (group.RandomPropertyId)
+    {
+        // Append the suffix to the name (ie: of the Monkey) if one exists
+        // These are found in ItemRandomSuffix.dbc and ItemRandomProperties.dbc
+        // even though the DBC name seems misleading
+        std::array<char const*, 16> const* suffix = nullptr;
+
+        if (group.RandomPropertyId < 0)
+        {
+            if (ItemRandomSuffixEntry const* itemRandEntry = sItemRandomSuffixStore.LookupEntry(-group.RandomPropertyId))
+                suffix = &itemRandEntry->Name;
+        }
+        else
+        {
+            if (ItemRandomPropertiesEntry const* itemRandEntry = sItemRandomPropertiesStore.LookupEntry(group.RandomPropertyId))
+                suffix = &itemRandEntry->Name;
+        }
+
+        // dbc local name
+        if (suffix)
+        {
+            name += ' ';
+            name += (*suffix)[locdbcIdx < TOTAL_LOCALES ? locdbcIdx : LOCALE_enUS];
+        }
+    }
+
+    if (Utf8toWStr(name, *foldedName))
+        wstrToLower(*foldedName);
+    else
+        foldedName->clear();
+
+    return *foldedName;
+}
@@ -0,0 +1,81 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _AUCTION_HOUSE_SEARCH_INDEX_H
+#define _AUCTION_HOUSE_SEARCH_INDEX_H
+
+#include "Common.h"
+#include <array>
+#include <map>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+struct AuctionEntry;
+struct ItemTemplate;
+
+/*
+ * Lookup structure of a single auction house used by auction browsing.
+ * Auctions are bucketed by item class and subclass, and the static item template
+ * fields the filters need are resolved once when the auction is listed.
+ * Auctions of the same item and random property share a name group, so the
+ * localized, lower cased name is built and matched once per group instead of per auction.
+ * Inventory type, quality, level, usability and the name itself are not indexed, they are
+ * still checked on every auction of the requested buckets.
+ * Kept in sync by AuctionHouseObject::AddAuction and AuctionHouseObject::RemoveAuction.
+ */
+class AuctionHouseSearchIndex
+{
+public:
+    struct Entry
+    {
+        AuctionEntry* Auction;
+        ItemTemplate const* Proto;
+        uint64 NameKey;
+    };
+
+    typedef std::map<uint32, Entry> EntryMap;
+
+    void Insert(AuctionEntry* auction);
+    void Erase(AuctionEntry const* auction);
+
+    [[nodiscard]] EntryMap const& GetEntries() const { return _entries; }
+
+    //! Appends the auctions of an item class and subclass (0xffffffff matches any) ordered by auction id.
+    void GetCandidates(uint32 itemClass, uint32 itemSubClass, std::vector<Entry const*>& candidates) const;
+
+    //! Lower cased name of a name group in the given locale, including the random property suffix.
+    std::wstring const& GetFoldedName(uint64 nameKey, LocaleConstant locIdx, LocaleConstant locdbcIdx);
+
+private:
+    struct NameGroup
+    {
+        uint32 ItemId = 0;
+        int32 RandomPropertyId = 0;
+        uint32 References = 0;
+        std::array<std::optional<std::wstring>, TOTAL_LOCALES> FoldedNames;
+    };
+
+    static uint32 MakeClassKey(uint32 itemClass, uint32 itemSubClass) { return (itemClass << 16) | (itemSubClass & 0xFFFF); }
+
+    EntryMap _entries;
+    std::map<uint32, std::set<uint32>> _byClass;
+    std::unordered_map<uint64, NameGroup> _nameGroups;
+};
+
+#endif
@@ -241,6 +241,10 @@ Battleground::~Battleground()
 
 void Battleground::Update(uint32 diff)
 {
+    // arena spectator commands queued by the last map update, sent on every update to keep the addon responsive
+    if (isArena())
+        m_SpectatorStream.Update(diff, m_Spectators);
+
     // pussywizard:
     m_UpdateTimer += diff;
     if (m_UpdateTimer < BATTLEGROUND_UPDATE_INTERVAL)
@@ -1294,6 +1298,12 @@ bool Battleground::HasFreeSlots() const
     return false;
 }
 
+void Battleground::RemoveSpectator(Player* p)
+{
+    m_Spectators.erase(p);
+    m_SpectatorStream.RemoveSpectator(p->GetGUID());
+}
+
 void Battleground::SpectatorsSendPacket(WDataStore& data)
 {
     for (SpectatorList::const_iterator itr = m_Spectators.begin(); itr != m_Spectators.end(); ++itr)
@@ -19,6 +19,7 @@
 #define __BATTLEGROUND_H
 
 #include "ArenaScore.h"
+#include "ArenaSpectatorStream.h"
 #include "Common.h"
 #include "DBCEnums.h"
 #include "GameObject.h"
@@ -386,12 +387,13 @@ public:
     typedef std::set<Player*> SpectatorList;
     typedef std::map<WOWGUID, WOWGUID> ToBeTeleportedMap;
     void AddSpectator(Player* p) { m_Spectators.insert(p); }
-    void RemoveSpectator(Player* p) { m_Spectators.erase(p); }
+    void RemoveSpectator(Player* p);
     bool HaveSpectators() { return !m_Spectators.empty(); }
     [[nodiscard]] const SpectatorList& GetSpectators() const { return m_Spectators; }
     void AddToBeTeleported(WOWGUID spectator, WOWGUID participant) { m_ToBeTeleported[spectator] = participant; }
     void RemoveToBeTeleported(WOWGUID spectator) { ToBeTeleportedMap::iterator itr = m_ToBeTeleported.find(spectator); if (itr != m_ToBeTeleported.end()) m_ToBeTeleported.erase(itr); }
     void SpectatorsSendPacket(WDataStore& data);
+    ArenaSpectatorStream& GetSpectatorStream() { return m_SpectatorStream; }
 
     [[nodiscard]] bool isArena() const        { return m_IsArena; }
     [[nodiscard]] bool isBattleground() const { return !m_IsArena; }
@@ -711,6 +713,7 @@ private:
     Group* m_BgRaids[PVP_TEAMS_COUNT];                   // 0 - alliance, 1 - horde
 
     SpectatorList m_Spectators;
+    ArenaSpectatorStream m_SpectatorStream;
     ToBeTeleportedMap m_ToBeTeleported;
 
     // Players count by team
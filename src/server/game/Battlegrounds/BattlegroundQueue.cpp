@@ -26,6 +26,7 @@
 #include "Group.h"
 #include "Language.h"
 #include "Log.h"
+#include "Metric.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -169,7 +170,6 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* group, Battle
 
     // pussywizard: store indices at which GroupQueueInfo is in m_QueuedGroups
     ginfo->BracketId = bracketId;
-    ginfo->GroupType = index;
 
     //add players from group to ginfo
     if (group)
@@ -189,7 +189,7 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* group, Battle
     }
 
     //add GroupInfo to m_QueuedGroups
-    m_QueuedGroups[bracketId][index].push_back(ginfo);
+    LinkGroup(ginfo, index, false);
 
     // announce world (this doesn't need mutex)
     SendJoinMessageArenaQueue(leader, ginfo, bracketEntry, isRated);
@@ -204,10 +204,28 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* group, Battle
     return ginfo;
 }
 
+void BattlegroundQueue::LinkGroup(GroupQueueInfo* ginfo, uint8 groupType, bool front)
+{
+    GroupsQueueType& queue = m_QueuedGroups[ginfo->BracketId][groupType];
+    ginfo->GroupType = groupType;
+    ginfo->QueueIterator = queue.insert(front ? queue.begin() : queue.end(), ginfo);
+}
+
+void BattlegroundQueue::UnlinkGroup(GroupQueueInfo* ginfo)
+{
+    m_QueuedGroups[ginfo->BracketId][ginfo->GroupType].erase(ginfo->QueueIterator);
+}
+
 void BattlegroundQueue::PlayerInvitedToBGUpdateAverageWaitTime(GroupQueueInfo* ginfo)
 {
     uint32 timeInQueue = std::max<uint32>(1, getMSTimeDiff(ginfo->JoinTime, GameTime::GetGameTimeMS().count()));
 
+    METRIC_VALUE("battleground_queue_wait", timeInQueue,
+        METRIC_TAG("bg_type", std::to_string(ginfo->BgTypeId)),
+        METRIC_TAG("bracket_id", std::to_string(ginfo->BracketId)),
+        METRIC_TAG("arena_type", std::to_string(ginfo->ArenaType)),
+        METRIC_TAG("rated", ginfo->IsRated ? "1" : "0"));
+
     // team_index: bg alliance - TEAM_ALLIANCE, bg horde - TEAM_HORDE, arena skirmish - TEAM_ALLIANCE, arena rated - TEAM_HORDE
     uint8 team_index;
     if (!ginfo->ArenaType)
@@ -278,25 +296,6 @@ void BattlegroundQueue::RemovePlayer(WOWGUID guid, bool decreaseInvitedCount)
     GroupQueueInfo* groupInfo = itr->second;
 
     uint32 _bracketId = groupInfo->BracketId;
-    uint32 _groupType = groupInfo->GroupType;
-
-    // find iterator
-    auto group_itr = m_QueuedGroups[_bracketId][_groupType].end();
-
-    for (auto k = m_QueuedGroups[_bracketId][_groupType].begin(); k != m_QueuedGroups[_bracketId][_groupType].end(); k++)
-        if ((*k) == groupInfo)
-        {
-            group_itr = k;
-            break;
-        }
-
-    // player can't be in queue without group, but just in case
-    if (group_itr == m_QueuedGroups[_bracketId][_groupType].end())
-    {
-        LOG_ERROR("bg.battleground", "BattlegroundQueue: ERROR Cannot find groupinfo for {}", guid.ToString());
-        //ABORT("BattlegroundQueue: ERROR Cannot find groupinfo for {}", guid.ToString());
-        return;
-    }
 
     LOG_DEBUG("bg.battleground", "BattlegroundQueue: Removing {}, from bracket_id {}", guid.ToString(), _bracketId);
 
@@ -336,7 +335,7 @@ void BattlegroundQueue::RemovePlayer(WOWGUID guid, bool decreaseInvitedCount)
     // remove group queue info no players left
     if (groupInfo->Players.empty())
     {
-        m_QueuedGroups[_bracketId][_groupType].erase(group_itr);
+        UnlinkGroup(groupInfo);
         delete groupInfo;
         return;
     }
@@ -559,9 +558,9 @@ bool BattlegroundQueue::CheckPremadeMatch(BattlegroundBracketId bracket_id, uint
             if (!(*itr)->IsInvitedToBGInstanceGUID && ((*itr)->JoinTime < time_before || (*itr)->Players.size() < MinPlayersPerTeam))
             {
                 //we must insert group to normal queue and erase pointer from premade queue
-                (*itr)->GroupType = BG_QUEUE_NORMAL_ALLIANCE + i; // pussywizard: update GroupQueueInfo internal variable
-                m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].push_front((*itr));
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE + i].erase(itr);
+                GroupQueueInfo* ginfo = *itr;
+                UnlinkGroup(ginfo);
+                LinkGroup(ginfo, BG_QUEUE_NORMAL_ALLIANCE + i, true);
             }
         }
     }
@@ -648,14 +647,11 @@ bool BattlegroundQueue::CheckSkirmishForSameFaction(BattlegroundBracketId bracke
     GroupQueueInfo* ginfo = m_SelectionPools[teamIndex].SelectedGroups.back();
 
     //set itr_team to group that was added to selection pool latest
-    GroupsQueueType::iterator itr_team = m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + static_cast<uint8>(teamIndex)].begin();
-    for (; itr_team != m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + static_cast<uint8>(teamIndex)].end(); ++itr_team)
-        if (ginfo == *itr_team)
-            break;
-
-    if (itr_team == m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + static_cast<uint8>(teamIndex)].end())
+    if (ginfo->GroupType != BG_QUEUE_NORMAL_ALLIANCE + static_cast<uint8>(teamIndex))
         return false;
 
+    GroupsQueueType::iterator itr_team = ginfo->QueueIterator;
+
     GroupsQueueType::iterator itr_team2 = itr_team;
     ++itr_team2;
 
@@ -675,23 +671,10 @@ bool BattlegroundQueue::CheckSkirmishForSameFaction(BattlegroundBracketId bracke
     {
         //set correct team
         (*itr)->teamId = otherTeam;
-        (*itr)->GroupType = static_cast<uint8>(BG_QUEUE_NORMAL_ALLIANCE) + static_cast<uint8>(otherTeam);
-
-        //add team to other queue
-        m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + static_cast<uint8>(otherTeam)].push_front(*itr);
 
-        //remove team from old queue
-        GroupsQueueType::iterator itr2 = itr_team;
-        ++itr2;
-
-        for (; itr2 != m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + static_cast<uint8>(teamIndex)].end(); ++itr2)
-        {
-            if (*itr2 == *itr)
-            {
-                m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + static_cast<uint8>(teamIndex)].erase(itr2);
-                break;
-            }
-        }
+        //move team from old queue to the other queue
+        UnlinkGroup(*itr);
+        LinkGroup(*itr, static_cast<uint8>(BG_QUEUE_NORMAL_ALLIANCE) + static_cast<uint8>(otherTeam), true);
     }
 
     return true;
@@ -928,16 +911,14 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
             // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
             if (aTeam->teamId != TEAM_ALLIANCE)
             {
-                aTeam->GroupType = BG_QUEUE_PREMADE_ALLIANCE;
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(itr_teams[TEAM_ALLIANCE]);
+                UnlinkGroup(aTeam);
+                LinkGroup(aTeam, BG_QUEUE_PREMADE_ALLIANCE, true);
             }
 
             if (hTeam->teamId != TEAM_HORDE)
             {
-                hTeam->GroupType = BG_QUEUE_PREMADE_HORDE;
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[TEAM_HORDE]);
+                UnlinkGroup(hTeam);
+                LinkGroup(hTeam, BG_QUEUE_PREMADE_HORDE, true);
             }
 
             arena->SetArenaMatchmakerRating(TEAM_ALLIANCE, aTeam->ArenaMatchmakerRating);
@@ -24,6 +24,7 @@
 #include "EventProcessor.h"
 #include <array>
 #include <deque>
+#include <list>
 
 constexpr auto COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME = 10;
 
@@ -46,6 +47,7 @@ struct GroupQueueInfo                                       // stores informatio
     uint32  PreviousOpponentsTeamId;                        // excluded from the current queue until the timer is met
     uint8   BracketId;                                      // BattlegroundBracketId
     uint8   GroupType;                                      // BattlegroundQueueGroupTypes
+    std::list<GroupQueueInfo*>::iterator QueueIterator;     // position in m_QueuedGroups[BracketId][GroupType], for constant time removal
 };
 
 enum BattlegroundQueueGroupTypes
@@ -129,6 +131,10 @@ public:
     [[nodiscard]] int32 GetQueueAnnouncementTimer(uint32 bracketId) const;
 
 private:
+    // keep GroupQueueInfo::GroupType and QueueIterator in sync with m_QueuedGroups
+    void LinkGroup(GroupQueueInfo* ginfo, uint8 groupType, bool front);
+    void UnlinkGroup(GroupQueueInfo* ginfo);
+
     uint32 m_WaitTimes[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
     uint32 m_WaitTimeLastIndex[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
 
@@ -17,8 +17,8 @@
 
 #include "WhoListCacheMgr.h"
 #include "GuildMgr.h"
-#include "ObjectAccessor.h"
-#include "World.h"
+#include "Player.h"
+#include "User.h"
 
 WhoListCacheMgr* WhoListCacheMgr::instance()
 {
@@ -28,34 +28,135 @@ WhoListCacheMgr* WhoListCacheMgr::instance()
 
 void WhoListCacheMgr::Update()
 {
-    // clear current list
-    _whoListStorage.clear();
-    _whoListStorage.reserve(sWorld->GetPlayerCount() + 1);
+    WhoListInfoVector whoList;
 
-    for (auto const& [guid, player] : ObjectAccessor::GetPlayers())
     {
-        if (!player->FindMap() || player->User()->PlayerLoading())
+        std::lock_guard<std::mutex> guard(_lock);
+        if (!_dirty)
+            return;
+
+        _dirty = false;
+
+        whoList.reserve(_players.size());
+        for (auto const& [guid, info] : _players)
+            whoList.push_back(info);
+    }
+
+    WhoListSnapshot snapshot = std::make_shared<WhoListInfoVector const>(std::move(whoList));
+
+    std::lock_guard<std::mutex> guard(_snapshotLock);
+    _snapshot.swap(snapshot);
+}
+
+WhoListSnapshot WhoListCacheMgr::GetWhoList() const
+{
+    std::lock_guard<std::mutex> guard(_snapshotLock);
+    return _snapshot;
+}
+
+void WhoListCacheMgr::AddPlayer(Player* player)
+{
+    WhoListPlayerInfoPtr info = BuildPlayerInfo(player, nullptr);
+    if (!info)
+        return;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _players[player->GetGUID()] = std::move(info);
+    _dirty = true;
+}
+
+void WhoListCacheMgr::RemovePlayer(WOWGUID guid)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_players.erase(guid))
+        _dirty = true;
+}
+
+void WhoListCacheMgr::UpdatePlayer(Player* player)
+{
+    WhoListPlayerInfoPtr previous;
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        auto itr = _players.find(player->GetGUID());
+        if (itr == _players.end())
+            return;
+
+        previous = itr->second;
+    }
+
+    WhoListPlayerInfoPtr info = BuildPlayerInfo(player, previous.get());
+
+    std::lock_guard<std::mutex> guard(_lock);
+    auto itr = _players.find(player->GetGUID());
+    if (itr == _players.end())
+        return;
+
+    if (info)
+        itr->second = std::move(info);
+    else
+        _players.erase(itr);
+
+    _dirty = true;
+}
+
+void WhoListCacheMgr::UpdateGuildName(uint32 guildId, std::string const& guildName)
+{
+    std::wstring wideGuildName;
+    if (!Utf8toWStr(guildName, wideGuildName))
+        return;
+
+    wstrToLower(wideGuildName);
+
+    std::lock_guard<std::mutex> guard(_lock);
+    for (auto& [guid, info] : _players)
+    {
+        if (info->GetGuildId() != guildId)
             continue;
 
-        std::string playerName = player->GetName();
-        std::wstring widePlayerName;
+        info = std::make_shared<WhoListPlayerInfo const>(info->GetGuid(), info->GetTeamId(), info->GetSecurity(), info->GetLevel(), info->GetClass(), info->GetRace(),
+            info->GetZoneId(), info->GetGender(), info->IsVisible(), info->GetWidePlayerName(), wideGuildName, info->GetPlayerName(), guildName, guildId);
+        _dirty = true;
+    }
+}
 
+WhoListPlayerInfoPtr WhoListCacheMgr::BuildPlayerInfo(Player* player, WhoListPlayerInfo const* previous)
+{
+    std::string playerName = player->GetName();
+    std::wstring widePlayerName;
+
+    // names only change while offline, the folded keys of the previous entry can be reused
+    if (previous && previous->GetPlayerName() == playerName)
+        widePlayerName = previous->GetWidePlayerName();
+    else
+    {
         if (!Utf8toWStr(playerName, widePlayerName))
-            continue;
+            return nullptr;
 
         wstrToLower(widePlayerName);
+    }
 
-        std::string guildName = sGuildMgr->GetGuildNameById(player->GetGuildId());
-        std::wstring wideGuildName;
+    uint32 guildId = player->GetGuildId();
+    std::string guildName;
+    std::wstring wideGuildName;
+
+    if (previous && previous->GetGuildId() == guildId)
+    {
+        guildName = previous->GetGuildName();
+        wideGuildName = previous->GetWideGuildName();
+    }
+    else
+    {
+        guildName = sGuildMgr->GetGuildNameById(guildId);
 
         if (!Utf8toWStr(guildName, wideGuildName))
-            continue;
+            return nullptr;
 
         wstrToLower(wideGuildName);
-
-        _whoListStorage.emplace_back(player->GetGUID(), player->GetTeamId(), player->User()->GetSecurity(), player->GetLevel(),
-            player->GetClass(), player->getRace(),
-            (player->IsSpectator() ? 4395 /*Dalaran*/ : player->GetZoneId()), player->getGender(), player->IsVisible(),
-            widePlayerName, wideGuildName, playerName, guildName);
     }
+
+    return std::make_shared<WhoListPlayerInfo const>(player->GetGUID(), player->GetTeamId(), player->User()->GetSecurity(), player->GetLevel(),
+        player->GetClass(), player->getRace(),
+        (player->IsSpectator() ? 4395 /*Dalaran*/ : player->GetZoneId()), player->getGender(), player->IsVisible(),
+        widePlayerName, wideGuildName, playerName, guildName, guildId);
 }
@@ -21,12 +21,17 @@
 #include "Common.h"
 #include "GUID.h"
 #include "SharedDefines.h"
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+class Player;
 
 class WhoListPlayerInfo
 {
 public:
     WhoListPlayerInfo(WOWGUID guid, TeamId team, AccountTypes security, uint8 level, uint8 clss, uint8 race, uint32 zoneid, uint8 gender, bool visible, std::wstring const& widePlayerName,
-        std::wstring const& wideGuildName, std::string const& playerName, std::string const& guildName) :
+        std::wstring const& wideGuildName, std::string const& playerName, std::string const& guildName, uint32 guildId) :
         _guid(guid),
         _team(team),
         _security(security),
@@ -39,7 +44,8 @@ public:
         _widePlayerName(widePlayerName),
         _wideGuildName(wideGuildName),
         _playerName(playerName),
-        _guildName(guildName) { }
+        _guildName(guildName),
+        _guildId(guildId) { }
 
     WOWGUID GetGuid() const { return _guid; }
     TeamId GetTeamId() const { return _team; }
@@ -54,6 +60,7 @@ public:
     std::wstring const& GetWideGuildName() const { return _wideGuildName; }
     std::string const& GetPlayerName() const { return _playerName; }
     std::string const& GetGuildName() const { return _guildName; }
+    uint32 GetGuildId() const { return _guildId; }
 
 private:
     WOWGUID _guid;
@@ -69,10 +76,18 @@ private:
     std::wstring _wideGuildName;
     std::string _playerName;
     std::string _guildName;
+    uint32 _guildId;
 };
 
-using WhoListInfoVector = std::vector<WhoListPlayerInfo>;
+using WhoListPlayerInfoPtr = std::shared_ptr<WhoListPlayerInfo const>;
+using WhoListInfoVector = std::vector<WhoListPlayerInfoPtr>;
+using WhoListSnapshot = std::shared_ptr<WhoListInfoVector const>;
 
+/*
+ * Who list entries are maintained per player on login, logout, level, zone, guild and visibility
+ * changes, which may happen on map threads. Update() publishes the changed entries as a new
+ * immutable snapshot, readers only copy the pointer to the current one under a short lock.
+ */
 class AC_GAME_API WhoListCacheMgr
 {
     WhoListCacheMgr() = default;
@@ -87,10 +102,24 @@ public:
     static WhoListCacheMgr* instance();
 
     void Update();
-    WhoListInfoVector const& GetWhoList() const { return _whoListStorage; }
+    [[nodiscard]] WhoListSnapshot GetWhoList() const;
+
+    void AddPlayer(Player* player);
+    void RemovePlayer(WOWGUID guid);
+    //! Refreshes the entry of an indexed player, does nothing for players that are not logged in yet
+    void UpdatePlayer(Player* player);
+    void UpdateGuildName(uint32 guildId, std::string const& guildName);
 
 protected:
-    WhoListInfoVector _whoListStorage;
+    static WhoListPlayerInfoPtr BuildPlayerInfo(Player* player, WhoListPlayerInfo const* previous);
+
+    std::mutex _lock;
+    std::unordered_map<WOWGUID, WhoListPlayerInfoPtr> _players;
+    bool _dirty = false;
+
+    // only guards the swap of the snapshot pointer, readers copy it and release the lock
+    mutable std::mutex _snapshotLock;
+    WhoListSnapshot _snapshot = std::make_shared<WhoListInfoVector const>();
 };
 
 #define sWhoListCacheMgr WhoListCacheMgr::instance()
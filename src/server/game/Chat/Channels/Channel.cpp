@@ -16,6 +16,7 @@
  */
 
 #include "AccountMgr.h"
+#include "ChannelFanout.h"
 #include "ChannelMgr.h"
 #include "CharacterCache.h"
 #include "Chat.h"
@@ -23,6 +24,7 @@
 #include "GameTime.h"
 #include "ObjectMgr.h"
 #include "Player.h"
+#include "ScriptMgr.h"
 #include "World.h"
 
 Channel::Channel(std::string const& name, uint32 channelId, uint32 channelDBId, TeamId teamId, bool announce, bool ownership):
@@ -210,6 +212,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
     pinfo.plrPtr = player;
 
     playersStore[guid] = pinfo;
+    _fanoutRecipients.reset();
 
     if (_channelRights.joinMessage.length())
         ChatHandler(player->User()).PSendSysMessage("%s", _channelRights.joinMessage.c_str());
@@ -274,6 +277,7 @@ void Channel::LeaveChannel(Player* player, bool send)
     bool changeowner = playersStore[guid].IsOwner();
 
     playersStore.erase(guid);
+    _fanoutRecipients.reset();
     if (_announce && ShouldAnnouncePlayer(player))
     {
         WDataStore data;
@@ -441,6 +445,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
     if (isOnChannel)
     {
         playersStore.erase(victim);
+        _fanoutRecipients.reset();
         bad->LeftChannel(this);
         RemoveWatching(bad);
         LeaveNotify(bad);
@@ -908,6 +913,9 @@ void Channel::SetOwner(WOWGUID guid, bool exclaim)
 
 void Channel::SendToAll(WDataStore* data, WOWGUID guid)
 {
+    if (SendToAllThroughFanout(data, guid))
+        return;
+
     for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
         if (!guid || !i->second.plrPtr->FriendListPtr()->IsIgnored(guid))
             i->second.plrPtr->User()->Send(data);
@@ -932,6 +940,32 @@ void Channel::SendToAllWatching(WDataStore* data)
         (*i)->User()->Send(data);
 }
 
+bool Channel::SendToAllThroughFanout(WDataStore* data, WOWGUID guid)
+{
+    // packet send hooks need the User on the world thread, keep the direct path for them
+    uint32 minMembers = sWorld->getIntConfig(CONFIG_CHANNEL_FANOUT_MIN_MEMBERS);
+    if (!minMembers || playersStore.size() < minMembers || !sChannelFanout->IsRunning() || sScriptMgr->HasPacketSendHooks())
+        return false;
+
+    if (!_fanoutRecipients)
+    {
+        auto recipients = std::make_shared<ChannelFanout::RecipientList>();
+        recipients->reserve(playersStore.size());
+        for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
+            if (std::shared_ptr<WowConnection> const& connection = i->second.plrPtr->User()->GetConnection())
+                recipients->emplace_back(i->first, connection);
+
+        _fanoutRecipients = std::move(recipients);
+    }
+
+    std::vector<WOWGUID> ignoredBy;
+    if (guid)
+        FriendListGetIgnoredBy(guid, &ignoredBy);
+
+    sChannelFanout->Send(_fanoutRecipients, *data, std::move(ignoredBy));
+    return true;
+}
+
 bool Channel::ShouldAnnouncePlayer(Player const* player) const
 {
     return !(player->User()->IsGMAccount() && sWorld->getBoolConfig(CONFIG_SILENTLY_GM_JOIN_TO_CHANNEL));
@@ -18,6 +18,7 @@
 #ifndef _CHANNEL_H
 #define _CHANNEL_H
 
+#include "ChannelFanoutDefines.h"
 #include "Common.h"
 #include "WDataStore.h"
 #include "User.h"
@@ -270,6 +271,7 @@ private:
     void SendToAllButOne(WDataStore* data, WOWGUID who);
     void SendToOne(WDataStore* data, WOWGUID who);
     void SendToAllWatching(WDataStore* data);
+    bool SendToAllThroughFanout(WDataStore* data, WOWGUID guid);
 
     bool ShouldAnnouncePlayer(Player const* player) const;
 
@@ -337,5 +339,6 @@ private:
     PlayerContainer playersStore;
     BannedContainer bannedStore;
     PlayersWatchingContainer playersWatchingStore;
+    std::shared_ptr<ChannelRecipientList const> _fanoutRecipients; // rebuilt on the next fan-out after a membership change
 };
 #endif
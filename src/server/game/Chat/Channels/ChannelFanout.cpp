@@ -0,0 +1,88 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ChannelFanout.h"
+#include "Log.h"
+#include "WDataStore.h"
+#include "WowConnection.h"
+#include <algorithm>
+
+ChannelFanout* ChannelFanout::instance()
+{
+    static ChannelFanout instance;
+    return &instance;
+}
+
+ChannelFanout::~ChannelFanout()
+{
+    Stop();
+}
+
+void ChannelFanout::Start()
+{
+    if (IsRunning())
+        return;
+
+    _running = true;
+    _workerThread = std::thread(&ChannelFanout::WorkerThread, this);
+
+    LOG_INFO("server.loading", "Channel message fan-out thread started.");
+}
+
+void ChannelFanout::Stop()
+{
+    if (!IsRunning())
+        return;
+
+    _running = false;
+    _queue.Cancel();
+    _workerThread.join();
+}
+
+void ChannelFanout::Send(std::shared_ptr<RecipientList const> recipients, WDataStore const& packet, std::vector<WOWGUID>&& ignoredBy)
+{
+    Job* job = new Job();
+    job->Recipients = std::move(recipients);
+    job->Packet = std::make_shared<WDataStore const>(packet);
+    job->IgnoredBy = std::move(ignoredBy);
+    _queue.Push(job);
+}
+
+void ChannelFanout::WorkerThread()
+{
+    for (;;)
+    {
+        Job* job = nullptr;
+        _queue.WaitAndPop(job);
+
+        if (!_running || !job)
+        {
+            delete job;
+            return;
+        }
+
+        for (auto const& [guid, connection] : *job->Recipients)
+        {
+            if (!job->IgnoredBy.empty() && std::binary_search(job->IgnoredBy.begin(), job->IgnoredBy.end(), guid))
+                continue;
+
+            connection->SendSharedPacket(job->Packet);
+        }
+
+        delete job;
+    }
+}
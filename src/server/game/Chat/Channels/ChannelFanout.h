@@ -0,0 +1,72 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _CHANNEL_FANOUT_H
+#define _CHANNEL_FANOUT_H
+
+#include "ChannelFanoutDefines.h"
+#include "Define.h"
+#include "PCQueue.h"
+#include <atomic>
+#include <thread>
+
+class WDataStore;
+
+/**
+ * Delivers channel messages of large channels off the world thread.
+ *
+ * The world thread builds the packet once and hands it over together with an
+ * immutable snapshot of the channel members' connections and the sorted list
+ * of players ignoring the sender. The worker thread then queues the same shared
+ * payload on every connection, the network threads encrypt and write it.
+ */
+class ChannelFanout
+{
+public:
+    typedef ChannelRecipientList RecipientList;
+
+    static ChannelFanout* instance();
+
+    void Start();
+    void Stop();
+
+    [[nodiscard]] bool IsRunning() const { return _running.load(std::memory_order_relaxed); }
+
+    // ignoredBy must be sorted, members listed there do not receive the packet
+    void Send(std::shared_ptr<RecipientList const> recipients, WDataStore const& packet, std::vector<WOWGUID>&& ignoredBy);
+
+private:
+    ChannelFanout() = default;
+    ~ChannelFanout();
+
+    struct Job
+    {
+        std::shared_ptr<RecipientList const> Recipients;
+        std::shared_ptr<WDataStore const> Packet;
+        std::vector<WOWGUID> IgnoredBy;
+    };
+
+    void WorkerThread();
+
+    ProducerConsumerQueue<Job*> _queue;
+    std::thread _workerThread;
+    std::atomic<bool> _running{false};
+};
+
+#define sChannelFanout ChannelFanout::instance()
+
+#endif
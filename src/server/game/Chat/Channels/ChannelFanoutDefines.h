@@ -0,0 +1,31 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _CHANNEL_FANOUT_DEFINES_H
+#define _CHANNEL_FANOUT_DEFINES_H
+
+#include "GUID.h"
+#include <memory>
+#include <utility>
+#include <vector>
+
+class WowConnection;
+
+// Snapshot of the members' connections a channel message is fanned out to
+typedef std::vector<std::pair<WOWGUID, std::shared_ptr<WowConnection>>> ChannelRecipientList;
+
+#endif
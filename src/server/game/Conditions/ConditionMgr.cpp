@@ -28,6 +28,18 @@
 #include "Spell.h"
 #include "SpellAuras.h"
 #include "SpellMgr.h"
+#include <algorithm>
+
+namespace
+{
+    ConditionList const EmptyConditionList;
+
+    // packs the two source keys of a condition container
+    inline uint64 MakeConditionKey(uint32 high, uint32 low)
+    {
+        return (uint64(high) << 32) | low;
+    }
+}
 
 // Checks if object meets the condition
 // Can have CONDITION_SOURCE_TYPE_NONE && !mReferenceId if called from a special event (ie: eventAI)
@@ -824,85 +836,89 @@ ConditionList ConditionMgr::GetConditionReferences(uint32 refId)
     return conditions;
 }
 
+void ConditionMgr::AddToConditionList(ConditionList& conditions, Condition* cond)
+{
+    // after the last condition of the same else group, conditions of a group keep their load order
+    ConditionList::iterator pos = std::upper_bound(conditions.begin(), conditions.end(), cond, [](Condition const* left, Condition const* right)
+    {
+        return left->ElseGroup < right->ElseGroup;
+    });
+    conditions.insert(pos, cond);
+}
+
 uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionList const& conditions)
 {
     if (conditions.empty())
         return GRID_MAP_TYPE_MASK_ALL;
-    //     groupId, typeMask
-    std::map<uint32, uint32> ElseGroupStore;
-    for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
-    {
-        // no point of having not loaded conditions in list
-        ASSERT((*i)->isLoaded() && "ConditionMgr::GetSearcherTypeMaskForConditionList - not yet loaded condition found in list");
-        std::map<uint32, uint32>::const_iterator itr = ElseGroupStore.find((*i)->ElseGroup);
-        // group not filled yet, fill with widest mask possible
-        if (itr == ElseGroupStore.end())
-            ElseGroupStore[(*i)->ElseGroup] = GRID_MAP_TYPE_MASK_ALL;
-        // no point of checking anymore, empty mask
-        else if (!(*itr).second)
-            continue;
 
-        if ((*i)->ReferenceId) // handle reference
-        {
-            ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
-            ASSERT(ref != ConditionReferenceStore.end() && "ConditionMgr::GetSearcherTypeMaskForConditionList - incorrect reference");
-            ElseGroupStore[(*i)->ElseGroup] &= GetSearcherTypeMaskForConditionList((*ref).second);
-        }
-        else // handle normal condition
+    // object will match conditions in one else group only when it matches all of them
+    // so, let's find a smallest possible mask for every group and include all of them
+    uint32 mask = 0;
+    ConditionList::const_iterator i = conditions.begin();
+    while (i != conditions.end())
+    {
+        uint32 elseGroup = (*i)->ElseGroup;
+        uint32 groupMask = GRID_MAP_TYPE_MASK_ALL;
+        for (; i != conditions.end() && (*i)->ElseGroup == elseGroup; ++i)
         {
-            // object will match conditions in one ElseGroupStore only when it matches all of them
-            // so, let's find a smallest possible mask which satisfies all conditions
-            ElseGroupStore[(*i)->ElseGroup] &= (*i)->GetSearcherTypeMaskForCondition();
+            // no point of having not loaded conditions in list
+            ASSERT((*i)->isLoaded() && "ConditionMgr::GetSearcherTypeMaskForConditionList - not yet loaded condition found in list");
+            // no point of checking anymore, empty mask
+            if (!groupMask)
+                continue;
+
+            if ((*i)->ReferenceId) // handle reference
+            {
+                ASSERT((*i)->ReferenceList && "ConditionMgr::GetSearcherTypeMaskForConditionList - incorrect reference");
+                groupMask &= GetSearcherTypeMaskForConditionList(*(*i)->ReferenceList);
+            }
+            else // handle normal condition
+                groupMask &= (*i)->GetSearcherTypeMaskForCondition();
         }
+
+        mask |= groupMask;
     }
-    // object will match condition when one of the checks in ElseGroupStore is matching
-    // so, let's include all possible masks
-    uint32 mask = 0;
-    for (std::map<uint32, uint32>::const_iterator i = ElseGroupStore.begin(); i != ElseGroupStore.end(); ++i) mask |= i->second;
 
     return mask;
 }
 
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
 {
-    //     groupId, groupCheckPassed
-    std::map<uint32, bool> ElseGroupStore;
-    for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
-    {
-        LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", (*i)->ConditionType, (*i)->ConditionValue1);
-        if ((*i)->isLoaded())
-        {
-            //! Find ElseGroup in ElseGroupStore
-            std::map<uint32, bool>::const_iterator itr = ElseGroupStore.find((*i)->ElseGroup);
-            //! If not found, add an entry in the store and set to true (placeholder)
-            if (itr == ElseGroupStore.end())
-                ElseGroupStore[(*i)->ElseGroup] = true;
-            else if (!(*itr).second)
+    // else groups are contiguous runs of the list (see AddToConditionList),
+    // the list is met as soon as all loaded conditions of one group are met
+    ConditionList::const_iterator i = conditions.begin();
+    while (i != conditions.end())
+    {
+        uint32 elseGroup = (*i)->ElseGroup;
+        bool hasLoadedConditions = false;
+        bool groupCheckPassed = true;
+        for (; i != conditions.end() && (*i)->ElseGroup == elseGroup; ++i)
+        {
+            Condition* cond = *i;
+            LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", cond->ConditionType, cond->ConditionValue1);
+            if (!groupCheckPassed || !cond->isLoaded())
                 continue;
 
-            if ((*i)->ReferenceId) // handle reference
+            hasLoadedConditions = true;
+            if (cond->ReferenceId) // handle reference
             {
-                ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
-                if (ref != ConditionReferenceStore.end())
+                if (cond->ReferenceList)
                 {
-                    if (!IsObjectMeetToConditionList(sourceInfo, (*ref).second))
-                        ElseGroupStore[(*i)->ElseGroup] = false;
+                    if (!IsObjectMeetToConditionList(sourceInfo, *cond->ReferenceList))
+                        groupCheckPassed = false;
                 }
                 else
                 {
-                    LOG_DEBUG("condition", "IsPlayerMeetToConditionList: Reference template -{} not found", (*i)->ReferenceId);
+                    LOG_DEBUG("condition", "IsPlayerMeetToConditionList: Reference template -{} not found", cond->ReferenceId);
                 }
             }
-            else // handle normal condition
-            {
-                if (!(*i)->Meets(sourceInfo))
-                    ElseGroupStore[(*i)->ElseGroup] = false;
-            }
+            else if (!cond->Meets(sourceInfo)) // handle normal condition
+                groupCheckPassed = false;
         }
-    }
-    for (std::map<uint32, bool>::const_iterator i = ElseGroupStore.begin(); i != ElseGroupStore.end(); ++i)
-        if (i->second)
+
+        if (hasLoadedConditions && groupCheckPassed)
             return true;
+    }
 
     return false;
 }
@@ -940,94 +956,116 @@ bool ConditionMgr::CanHaveSourceIdSet(ConditionSourceType sourceType) const
     return (sourceType == CONDITION_SOURCE_TYPE_SMART_EVENT);
 }
 
-ConditionList ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry)
+ConditionList const& ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry)
 {
-    ConditionList spellCond;
     if (sourceType > CONDITION_SOURCE_TYPE_NONE && sourceType < CONDITION_SOURCE_TYPE_MAX)
     {
-        ConditionContainer::const_iterator itr = ConditionStore.find(sourceType);
+        ConditionContainer::const_iterator itr = ConditionStore.find(MakeConditionKey(sourceType, entry));
         if (itr != ConditionStore.end())
         {
-            ConditionTypeContainer::const_iterator i = (*itr).second.find(entry);
-            if (i != (*itr).second.end())
-            {
-                spellCond = (*i).second;
-                LOG_DEBUG("condition", "GetConditionsForNotGroupedEntry: found conditions for type {} and entry {}", uint32(sourceType), entry);
-            }
+            LOG_DEBUG("condition", "GetConditionsForNotGroupedEntry: found conditions for type {} and entry {}", uint32(sourceType), entry);
+            return itr->second;
         }
     }
-    return spellCond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId)
+ConditionList const& ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId)
 {
-    ConditionList                                   cond;
-    CreatureSpellConditionContainer::const_iterator itr = SpellClickEventConditionStore.find(creatureId);
+    CreatureSpellConditionContainer::const_iterator itr = SpellClickEventConditionStore.find(MakeConditionKey(creatureId, spellId));
     if (itr != SpellClickEventConditionStore.end())
     {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
-        if (i != (*itr).second.end())
-        {
-            cond = (*i).second;
-            LOG_DEBUG("condition", "GetConditionsForSpellClickEvent: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
-        }
+        LOG_DEBUG("condition", "GetConditionsForSpellClickEvent: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
+        return itr->second;
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId)
+ConditionList const& ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId)
 {
-    ConditionList                                   cond;
-    CreatureSpellConditionContainer::const_iterator itr = VehicleSpellConditionStore.find(creatureId);
+    CreatureSpellConditionContainer::const_iterator itr = VehicleSpellConditionStore.find(MakeConditionKey(creatureId, spellId));
     if (itr != VehicleSpellConditionStore.end())
     {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
-        if (i != (*itr).second.end())
-        {
-            cond = (*i).second;
-            LOG_DEBUG("condition", "GetConditionsForVehicleSpell: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
-        }
+        LOG_DEBUG("condition", "GetConditionsForVehicleSpell: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
+        return itr->second;
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType)
+ConditionList const& ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType)
 {
-    ConditionList                                cond;
-    SmartEventConditionContainer::const_iterator itr = SmartEventConditionStore.find(std::make_pair(entryOrGuid, sourceType));
+    SmartEventConditionContainer::const_iterator itr = SmartEventConditionStore.find(MakeConditionKey(uint32(entryOrGuid), sourceType));
     if (itr != SmartEventConditionStore.end())
     {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(eventId + 1);
-        if (i != (*itr).second.end())
+        auto i = itr->second.find(eventId + 1);
+        if (i != itr->second.end())
         {
-            cond = (*i).second;
             LOG_DEBUG("condition", "GetConditionsForSmartEvent: found conditions for Smart Event entry or guid {} event_id {}", entryOrGuid, eventId);
+            return i->second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId)
+ConditionList const& ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId)
 {
-    ConditionList                               cond;
-    NpcVendorConditionContainer::const_iterator itr = NpcVendorConditionContainerStore.find(creatureId);
+    NpcVendorConditionContainer::const_iterator itr = NpcVendorConditionContainerStore.find(MakeConditionKey(creatureId, itemId));
     if (itr != NpcVendorConditionContainerStore.end())
     {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(itemId);
-        if (i != (*itr).second.end())
+        if (itemId)
         {
-            cond = (*i).second;
-            if (itemId)
-            {
-                LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {} item {}", creatureId, itemId);
-            }
-            else
-            {
-                LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {}", creatureId);
-            }
+            LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {} item {}", creatureId, itemId);
+        }
+        else
+        {
+            LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {}", creatureId);
+        }
+        return itr->second;
+    }
+    return EmptyConditionList;
+}
+
+void ConditionMgr::ResolveReferences(ConditionList const& conditions)
+{
+    for (Condition* cond : conditions)
+    {
+        if (!cond->ReferenceId)
+            continue;
+
+        ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(cond->ReferenceId);
+        if (ref != ConditionReferenceStore.end())
+            cond->ReferenceList = &ref->second;
+        else
+        {
+            cond->ReferenceList = nullptr;
+            LOG_ERROR("sql.sql", "Condition (SourceType: {} SourceGroup: {} SourceEntry: {}) references missing reference template -{}", uint32(cond->SourceType), cond->SourceGroup, cond->SourceEntry, cond->ReferenceId);
         }
     }
-    return cond;
+}
+
+void ConditionMgr::ResolveAllReferences()
+{
+    for (auto const& [refId, conditions] : ConditionReferenceStore)
+        ResolveReferences(conditions);
+
+    for (auto const& [key, conditions] : ConditionStore)
+        ResolveReferences(conditions);
+
+    for (auto const& [key, conditions] : VehicleSpellConditionStore)
+        ResolveReferences(conditions);
+
+    for (auto const& [key, conditions] : SpellClickEventConditionStore)
+        ResolveReferences(conditions);
+
+    for (auto const& [key, conditions] : NpcVendorConditionContainerStore)
+        ResolveReferences(conditions);
+
+    for (auto const& [key, events] : SmartEventConditionStore)
+        for (auto const& [eventId, conditions] : events)
+            ResolveReferences(conditions);
+
+    // grouped conditions stored in loot templates, gossip menus and spell effects
+    ResolveReferences(AllocatedMemoryStore);
 }
 
 void ConditionMgr::LoadConditions(bool isReload)
@@ -1137,12 +1175,7 @@ void ConditionMgr::LoadConditions(bool isReload)
         if (iSourceTypeOrReferenceId < 0) // it is a reference template
         {
             uint32 uRefId = std::abs(iSourceTypeOrReferenceId);
-            if (ConditionReferenceStore.find(uRefId) == ConditionReferenceStore.end()) // make sure we have a list for our conditions, based on reference id
-            {
-                ConditionList mCondList;
-                ConditionReferenceStore[uRefId] = mCondList;
-            }
-            ConditionReferenceStore[uRefId].push_back(cond); // add to reference storage
+            AddToConditionList(ConditionReferenceStore[uRefId], cond); // add to reference storage
             count++;
             continue;
         } // end of reference templates
@@ -1230,7 +1263,7 @@ void ConditionMgr::LoadConditions(bool isReload)
                 break;
             case CONDITION_SOURCE_TYPE_SPELL_CLICK_EVENT:
             {
-                SpellClickEventConditionStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                AddToConditionList(SpellClickEventConditionStore[MakeConditionKey(cond->SourceGroup, cond->SourceEntry)], cond);
                 valid = true;
                 ++count;
                 continue; // do not add to m_AllocatedMemory to avoid double deleting
@@ -1240,23 +1273,21 @@ void ConditionMgr::LoadConditions(bool isReload)
                 break;
             case CONDITION_SOURCE_TYPE_VEHICLE_SPELL:
             {
-                VehicleSpellConditionStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                AddToConditionList(VehicleSpellConditionStore[MakeConditionKey(cond->SourceGroup, cond->SourceEntry)], cond);
                 valid = true;
                 ++count;
                 continue; // do not add to m_AllocatedMemory to avoid double deleting
             }
             case CONDITION_SOURCE_TYPE_SMART_EVENT:
             {
-                //! TODO: PAIR_32 ?
-                std::pair<int32, uint32> key = std::make_pair(cond->SourceEntry, cond->SourceId);
-                SmartEventConditionStore[key][cond->SourceGroup].push_back(cond);
+                AddToConditionList(SmartEventConditionStore[MakeConditionKey(cond->SourceEntry, cond->SourceId)][cond->SourceGroup], cond);
                 valid = true;
                 ++count;
                 continue;
             }
             case CONDITION_SOURCE_TYPE_NPC_VENDOR:
             {
-                NpcVendorConditionContainerStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                AddToConditionList(NpcVendorConditionContainerStore[MakeConditionKey(cond->SourceGroup, cond->SourceEntry)], cond);
                 valid = true;
                 ++count;
                 continue;
@@ -1284,25 +1315,14 @@ void ConditionMgr::LoadConditions(bool isReload)
         }
 
         // handle not grouped conditions
-        // make sure we have a storage list for our SourceType
-        if (ConditionStore.find(cond->SourceType) == ConditionStore.end())
-        {
-            ConditionTypeContainer mTypeMap;
-            ConditionStore[cond->SourceType] = mTypeMap; // add new empty list for SourceType
-        }
-
-        // make sure we have a condition list for our SourceType's entry
-        if (ConditionStore[cond->SourceType].find(cond->SourceEntry) == ConditionStore[cond->SourceType].end())
-        {
-            ConditionList mCondList;
-            ConditionStore[cond->SourceType][cond->SourceEntry] = mCondList;
-        }
-
         // add new Condition to storage based on Type/Entry
-        ConditionStore[cond->SourceType][cond->SourceEntry].push_back(cond);
+        AddToConditionList(ConditionStore[MakeConditionKey(cond->SourceType, cond->SourceEntry)], cond);
         ++count;
     } while (result->NextRow());
 
+    // reference templates can be loaded after the conditions using them
+    ResolveAllReferences();
+
     LOG_INFO("server.loading", ">> Loaded {} conditions in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -1332,7 +1352,7 @@ bool ConditionMgr::addToGossipMenus(Condition* cond)
         {
             if ((*itr).second.MenuID == cond->SourceGroup && (*itr).second.TextID == uint32(cond->SourceEntry))
             {
-                (*itr).second.Conditions.push_back(cond);
+                AddToConditionList((*itr).second.Conditions, cond);
                 return true;
             }
         }
@@ -1351,7 +1371,7 @@ bool ConditionMgr::addToGossipMenuItems(Condition* cond)
         {
             if ((*itr).second.MenuID == cond->SourceGroup && (*itr).second.OptionID == uint32(cond->SourceEntry))
             {
-                (*itr).second.Conditions.push_back(cond);
+                AddToConditionList((*itr).second.Conditions, cond);
                 return true;
             }
         }
@@ -1440,7 +1460,7 @@ bool ConditionMgr::addToSpellImplicitTargetConditions(Condition* cond)
                     delete sharedList;
             }
             if (sharedList)
-                sharedList->push_back(cond);
+                AddToConditionList(*sharedList, cond);
             break;
         }
     }
@@ -2462,76 +2482,46 @@ bool ConditionMgr::isConditionTypeValid(Condition* cond)
 
 void ConditionMgr::Clean()
 {
-    for (ConditionReferenceContainer::iterator itr = ConditionReferenceStore.begin(); itr != ConditionReferenceStore.end(); ++itr)
-    {
-        for (ConditionList::const_iterator it = itr->second.begin(); it != itr->second.end(); ++it) delete *it;
-        itr->second.clear();
-    }
+    for (auto const& [refId, conditions] : ConditionReferenceStore)
+        for (Condition* cond : conditions)
+            delete cond;
 
     ConditionReferenceStore.clear();
 
-    for (ConditionContainer::iterator itr = ConditionStore.begin(); itr != ConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
+    for (auto const& [key, conditions] : ConditionStore)
+        for (Condition* cond : conditions)
+            delete cond;
 
     ConditionStore.clear();
 
-    for (CreatureSpellConditionContainer::iterator itr = VehicleSpellConditionStore.begin(); itr != VehicleSpellConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
+    for (auto const& [key, conditions] : VehicleSpellConditionStore)
+        for (Condition* cond : conditions)
+            delete cond;
 
     VehicleSpellConditionStore.clear();
 
-    for (SmartEventConditionContainer::iterator itr = SmartEventConditionStore.begin(); itr != SmartEventConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
+    for (auto const& [key, events] : SmartEventConditionStore)
+        for (auto const& [eventId, conditions] : events)
+            for (Condition* cond : conditions)
+                delete cond;
 
     SmartEventConditionStore.clear();
 
-    for (CreatureSpellConditionContainer::iterator itr = SpellClickEventConditionStore.begin(); itr != SpellClickEventConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
+    for (auto const& [key, conditions] : SpellClickEventConditionStore)
+        for (Condition* cond : conditions)
+            delete cond;
 
     SpellClickEventConditionStore.clear();
 
-    for (NpcVendorConditionContainer::iterator itr = NpcVendorConditionContainerStore.begin(); itr != NpcVendorConditionContainerStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
+    for (auto const& [key, conditions] : NpcVendorConditionContainerStore)
+        for (Condition* cond : conditions)
+            delete cond;
 
     NpcVendorConditionContainerStore.clear();
 
     // this is a BIG hack, feel free to fix it if you can figure out the ConditionMgr ;)
-    for (std::list<Condition*>::const_iterator itr = AllocatedMemoryStore.begin(); itr != AllocatedMemoryStore.end(); ++itr) delete *itr;
+    for (Condition* cond : AllocatedMemoryStore)
+        delete cond;
 
     AllocatedMemoryStore.clear();
 }
@@ -22,6 +22,8 @@
 #include "Errors.h"
 #include <list>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 class Player;
 class Unit;
@@ -190,6 +192,9 @@ struct ConditionSourceInfo
     }
 };
 
+struct Condition;
+typedef std::vector<Condition*> ConditionList;
+
 struct Condition
 {
     ConditionSourceType     SourceType;        //SourceTypeOrReferenceId
@@ -204,6 +209,7 @@ struct Condition
     uint32                  ErrorType;
     uint32                  ErrorTextId;
     uint32                  ReferenceId;
+    ConditionList const*    ReferenceList;     // reference template of ReferenceId, resolved once all conditions are loaded
     uint32                  ScriptId;
     uint8                   ConditionTarget;
     bool                    NegativeCondition;
@@ -221,6 +227,7 @@ struct Condition
         ConditionValue2    = 0;
         ConditionValue3    = 0;
         ReferenceId        = 0;
+        ReferenceList      = nullptr;
         ErrorType          = 0;
         ErrorTextId        = 0;
         ScriptId           = 0;
@@ -233,14 +240,13 @@ struct Condition
     uint32 GetMaxAvailableConditionTargets();
 };
 
-typedef std::list<Condition*> ConditionList;
-typedef std::map<uint32, ConditionList> ConditionTypeContainer;
-typedef std::map<ConditionSourceType, ConditionTypeContainer> ConditionContainer;
-typedef std::map<uint32, ConditionTypeContainer> CreatureSpellConditionContainer;
-typedef std::map<uint32, ConditionTypeContainer> NpcVendorConditionContainer;
-typedef std::map<std::pair<int32, uint32 /*SAI source_type*/>, ConditionTypeContainer> SmartEventConditionContainer;
+// all containers are keyed by both source keys packed into one value, see MakeConditionKey
+typedef std::unordered_map<uint64 /*source type | entry*/, ConditionList> ConditionContainer;
+typedef std::unordered_map<uint64 /*creature | spell*/, ConditionList> CreatureSpellConditionContainer;
+typedef std::unordered_map<uint64 /*creature | item*/, ConditionList> NpcVendorConditionContainer;
+typedef std::unordered_map<uint64 /*entryOrGuid | SAI source_type*/, std::unordered_map<uint32 /*event_id + 1*/, ConditionList>> SmartEventConditionContainer;
 
-typedef std::map<uint32, ConditionList> ConditionReferenceContainer;//only used for references
+typedef std::unordered_map<uint32, ConditionList> ConditionReferenceContainer;//only used for references
 
 class ConditionMgr
 {
@@ -255,17 +261,22 @@ public:
     bool isConditionTypeValid(Condition* cond);
     ConditionList GetConditionReferences(uint32 refId);
 
+    // Every condition list is kept ordered by ElseGroup so each else group is a contiguous run,
+    // conditions must be added to lists through this function
+    static void AddToConditionList(ConditionList& conditions, Condition* cond);
+
     uint32 GetSearcherTypeMaskForConditionList(ConditionList const& conditions);
     bool IsObjectMeetToConditions(WorldObject* object, ConditionList const& conditions);
     bool IsObjectMeetToConditions(WorldObject* object1, WorldObject* object2, ConditionList const& conditions);
     bool IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
     [[nodiscard]] bool CanHaveSourceGroupSet(ConditionSourceType sourceType) const;
     [[nodiscard]] bool CanHaveSourceIdSet(ConditionSourceType sourceType) const;
-    ConditionList GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry);
-    ConditionList GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId);
-    ConditionList GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType);
-    ConditionList GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId);
-    ConditionList GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId);
+    // the returned lists stay valid until the next conditions reload
+    ConditionList const& GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry);
+    ConditionList const& GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId);
+    ConditionList const& GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType);
+    ConditionList const& GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId);
+    ConditionList const& GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId);
 
 private:
     bool isSourceTypeValid(Condition* cond);
@@ -274,9 +285,11 @@ private:
     bool addToGossipMenuItems(Condition* cond);
     bool addToSpellImplicitTargetConditions(Condition* cond);
     bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
+    void ResolveReferences(ConditionList const& conditions);
+    void ResolveAllReferences();
 
     void Clean(); // free up resources
-    std::list<Condition*> AllocatedMemoryStore; // some garbage collection :)
+    ConditionList AllocatedMemoryStore; // some garbage collection :)
 
     ConditionContainer                ConditionStore;
     ConditionReferenceContainer       ConditionReferenceStore;
@@ -31,6 +31,7 @@
 #include "LFGQueue.h"
 #include "LFGScripts.h"
 #include "Language.h"
+#include "Metric.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
 #include "Player.h"
@@ -334,11 +335,14 @@ namespace lfg
             this->lastProposalId = m_lfgProposalId; // pussywizard: task 2 is done independantly, store previous value in LFGMgr for future use
             uint8 newGroupsProcessed = 0;
             // Check if a proposal can be formed with the new groups being added
-            for (LfgQueueContainer::iterator it = QueuesStore.begin(); it != QueuesStore.end(); ++it)
             {
-                newGroupsProcessed += it->second.FindGroups();
-                if (newGroupsProcessed)
-                    break;
+                METRIC_TIMER("lfg_update_time", METRIC_TAG("type", "Find groups"));
+                for (LfgQueueContainer::iterator it = QueuesStore.begin(); it != QueuesStore.end(); ++it)
+                {
+                    newGroupsProcessed += it->second.FindGroups();
+                    if (newGroupsProcessed)
+                        break;
+                }
             }
 
             // Update all players status queue info
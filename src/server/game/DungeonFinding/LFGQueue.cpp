@@ -34,6 +34,40 @@ namespace lfg
         joinTime(time_t(GameTime::GetGameTime().count())), lastRefreshTime(joinTime), tanks(LFG_TANKS_NEEDED),
         healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED) { }
 
+    LfgQueueData::LfgQueueData(time_t _joinTime, LfgDungeonSet _dungeons, LfgRolesMap _roles) :
+        joinTime(_joinTime), lastRefreshTime(_joinTime), tanks(LFG_TANKS_NEEDED), healers(LFG_HEALERS_NEEDED),
+        dps(LFG_DPS_NEEDED), dungeons(std::move(_dungeons)), roles(std::move(_roles))
+    {
+        hasDungeonMask = true;
+        for (uint32 dungeonId : dungeons)
+        {
+            if (dungeonId >= LFG_DUNGEON_MASK_SIZE)
+            {
+                hasDungeonMask = false;
+                break;
+            }
+            dungeonMask.set(dungeonId);
+        }
+
+        for (LfgRolesMap::const_iterator itr = roles.begin(); itr != roles.end(); ++itr)
+        {
+            switch (itr->second & ~PLAYER_ROLE_LEADER)
+            {
+                case PLAYER_ROLE_TANK:
+                    ++onlyTanks;
+                    break;
+                case PLAYER_ROLE_HEALER:
+                    ++onlyHealers;
+                    break;
+                case PLAYER_ROLE_DAMAGE:
+                    ++onlyDps;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
     void LFGQueue::AddToQueue(WOWGUID guid, bool failedProposal)
     {
         LOG_DEBUG("lfg", "ADD AddToQueue: {}, failed proposal: {}", guid.ToString(), failedProposal ? 1 : 0);
@@ -244,6 +278,35 @@ namespace lfg
         return selfCompatibility;
     }
 
+    LfgCompatibility LFGQueue::CheckQueueDataCompatibility(std::array<LfgQueueData*, 5> const& queues, LfgDungeonMask& dungeonMask, bool& dungeonsFromMask)
+    {
+        uint8 onlyTanks = 0;
+        uint8 onlyHealers = 0;
+        uint8 onlyDps = 0;
+        dungeonsFromMask = true;
+        dungeonMask.set();
+        for (uint8 i = 0; i < 5 && queues[i]; ++i)
+        {
+            LfgQueueData const* queue = queues[i];
+            onlyTanks += queue->onlyTanks;
+            onlyHealers += queue->onlyHealers;
+            onlyDps += queue->onlyDps;
+
+            if (queue->hasDungeonMask)
+                dungeonMask &= queue->dungeonMask;
+            else
+                dungeonsFromMask = false;
+        }
+
+        if (onlyTanks > LFG_TANKS_NEEDED || onlyHealers > LFG_HEALERS_NEEDED || onlyDps > LFG_DPS_NEEDED)
+            return LFG_INCOMPATIBLES_NO_ROLES;
+
+        if (dungeonsFromMask && dungeonMask.none())
+            return LFG_INCOMPATIBLES_NO_DUNGEONS;
+
+        return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
+    }
+
     LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const WOWGUID& newGuid, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles)
     {
         LOG_DEBUG("lfg", "CHECK CheckCompatibility: {}, new guid: {}", checkWith.toString(), newGuid.ToString());
@@ -265,6 +328,7 @@ namespace lfg
         uint8 numLfgGroups = 0;
         WOWGUID guid;
         uint64 addToFoundMask = 0;
+        std::array<LfgQueueData*, 5> queues = { };
 
         for (uint8 i = 0; i < 5 && !(guid = check.guids[i]).IsEmpty() && numLfgGroups < 2 && numPlayers <= MAXGROUPSIZE; ++i)
         {
@@ -276,6 +340,8 @@ namespace lfg
                 return LFG_COMPATIBILITY_PENDING;
             }
 
+            queues[i] = &itQueue->second;
+
             // Store group so we don't need to call Mgr to get it later (if it's player group will be 0 otherwise would have joined as group)
             for (LfgRolesMap::const_iterator it2 = itQueue->second.roles.begin(); it2 != itQueue->second.roles.end(); ++it2)
                 proposalGroups[it2->first] = itQueue->first.IsGroup() ? itQueue->first : WOWGUID::Empty;
@@ -311,12 +377,20 @@ namespace lfg
         if (numPlayers > MAXGROUPSIZE)
             return LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS;
 
+        bool dungeonsFromMask = false;
+        LfgDungeonMask dungeonMask;
+
         // If it's single group no need to check for duplicate players, ignores, bad roles or bad dungeons as it's been checked before joining
         if (check.size() > 1)
         {
+            // cheap rejects from the precomputed queue data before any role or dungeon set is built
+            LfgCompatibility compatibility = CheckQueueDataCompatibility(queues, dungeonMask, dungeonsFromMask);
+            if (compatibility != LFG_COMPATIBLES_WITH_LESS_PLAYERS)
+                return compatibility;
+
             for (uint8 i = 0; i < 5 && check.guids[i]; ++i)
             {
-                const LfgRolesMap& roles = QueueDataStore[check.guids[i]].roles;
+                const LfgRolesMap& roles = queues[i]->roles;
                 for (LfgRolesMap::const_iterator itRoles = roles.begin(); itRoles != roles.end(); ++itRoles)
                 {
                     LfgRolesMap::const_iterator itPlayer;
@@ -369,22 +443,25 @@ namespace lfg
             else
                 addToFoundMask |= (((uint64)1) << (roleCheckResult - 1));
 
-            proposalDungeons = QueueDataStore[check.front()].dungeons;
-            for (uint8 i = 1; i < 5 && check.guids[i]; ++i)
+            // with dungeon masks the set is only built once a proposal is created
+            if (!dungeonsFromMask)
             {
-                LfgDungeonSet temporal;
-                LfgDungeonSet& dungeons = QueueDataStore[check.guids[i]].dungeons;
-                std::set_intersection(proposalDungeons.begin(), proposalDungeons.end(), dungeons.begin(), dungeons.end(), std::inserter(temporal, temporal.begin()));
-                proposalDungeons = temporal;
-            }
+                proposalDungeons = queues[0]->dungeons;
+                for (uint8 i = 1; i < 5 && check.guids[i]; ++i)
+                {
+                    LfgDungeonSet temporal;
+                    LfgDungeonSet const& dungeons = queues[i]->dungeons;
+                    std::set_intersection(proposalDungeons.begin(), proposalDungeons.end(), dungeons.begin(), dungeons.end(), std::inserter(temporal, temporal.begin()));
+                    proposalDungeons = temporal;
+                }
 
-            if (proposalDungeons.empty())
-                return LFG_INCOMPATIBLES_NO_DUNGEONS;
+                if (proposalDungeons.empty())
+                    return LFG_INCOMPATIBLES_NO_DUNGEONS;
+            }
         }
         else
         {
-            WOWGUID gguid = check.front();
-            const LfgQueueData& queue = QueueDataStore[gguid];
+            const LfgQueueData& queue = *queues[0];
             proposalDungeons = queue.dungeons;
             proposalRoles = queue.roles;
             LFGMgr::CheckGroupRoles(proposalRoles);          // assing new roles
@@ -396,9 +473,8 @@ namespace lfg
             strGuids.addRoles(proposalRoles);
             for (uint8 i = 0; i < 5 && check.guids[i]; ++i)
             {
-                LfgQueueDataContainer::iterator itr = QueueDataStore.find(check.guids[i]);
-                if (!itr->second.bestCompatible.empty()) // update if groups don't have it empty (for empty it will be generated in UpdateQueueTimers)
-                    UpdateBestCompatibleInQueue(itr, strGuids);
+                if (!queues[i]->bestCompatible.empty()) // update if groups don't have it empty (for empty it will be generated in UpdateQueueTimers)
+                    UpdateBestCompatibleInQueue(*queues[i], strGuids);
             }
             AddToCompatibles(strGuids);
             foundMask |= addToFoundMask;
@@ -412,6 +488,11 @@ namespace lfg
         if (!sLFGMgr->AllQueued(check)) // can't create proposal
             return LFG_COMPATIBILITY_PENDING;
 
+        if (dungeonsFromMask)
+            for (uint32 dungeonId = 0; dungeonId < LFG_DUNGEON_MASK_SIZE; ++dungeonId)
+                if (dungeonMask.test(dungeonId))
+                    proposalDungeons.insert(dungeonId);
+
         // Create a new proposal
         proposal.cancelTime = GameTime::GetGameTime().count() + LFG_TIME_PROPOSAL;
         proposal.state = LFG_PROPOSAL_INITIATING;
@@ -579,15 +660,14 @@ namespace lfg
             if (itr->hasGuid(itrQueue->first))
             {
                 ++numOfCompatibles;
-                UpdateBestCompatibleInQueue(itrQueue, *itr);
+                UpdateBestCompatibleInQueue(itrQueue->second, *itr);
             }
         return numOfCompatibles;
     }
 
-    void LFGQueue::UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, Lfg5Guids const& key)
+    void LFGQueue::UpdateBestCompatibleInQueue(LfgQueueData& queueData, Lfg5Guids const& key)
     {
         LOG_DEBUG("lfg", "UpdateBestCompatibleInQueue: {}", key.toString());
-        LfgQueueData& queueData = itrQueue->second;
 
         uint8 storedSize = queueData.bestCompatible.size();
         uint8 size = key.size();
@@ -18,6 +18,8 @@
 #ifndef _LFGQUEUE_H
 #define _LFGQUEUE_H
 
+#include <array>
+#include <bitset>
 #include <utility>
 
 #include "LFG.h"
@@ -37,15 +39,16 @@ namespace lfg
         LFG_COMPATIBLES_MATCH                                  // Must be the last one
     };
 
+    // LFGDungeons.dbc ids fit in this mask, queue data with bigger ids falls back to set intersection
+    constexpr uint32 LFG_DUNGEON_MASK_SIZE = 512;
+    typedef std::bitset<LFG_DUNGEON_MASK_SIZE> LfgDungeonMask;
+
     // Stores player or group queue info
     struct LfgQueueData
     {
         LfgQueueData();
 
-        LfgQueueData(time_t _joinTime, LfgDungeonSet  _dungeons, LfgRolesMap  _roles):
-            joinTime(_joinTime), lastRefreshTime(_joinTime), tanks(LFG_TANKS_NEEDED), healers(LFG_HEALERS_NEEDED),
-            dps(LFG_DPS_NEEDED), dungeons(std::move(_dungeons)), roles(std::move(_roles))
-        { }
+        LfgQueueData(time_t _joinTime, LfgDungeonSet  _dungeons, LfgRolesMap  _roles);
 
         time_t joinTime;                                       // Player queue join time (to calculate wait times)
         time_t lastRefreshTime;                                // pussywizard
@@ -55,6 +58,13 @@ namespace lfg
         LfgDungeonSet dungeons;                                // Selected Player/Group Dungeon/s
         LfgRolesMap roles;                                     // Selected Player Role/s
         Lfg5Guids bestCompatible;                              // Best compatible combination of people queued
+
+        // Precomputed at join so compatibility checks can reject combinations without building role and dungeon sets
+        LfgDungeonMask dungeonMask;                            // Selected dungeons as bits, only valid with hasDungeonMask
+        bool hasDungeonMask{false};
+        uint8 onlyTanks{0};                                    // Players which selected tank as their only role
+        uint8 onlyHealers{0};                                  // Players which selected healer as their only role
+        uint8 onlyDps{0};                                      // Players which selected damage as their only role
     };
 
     struct LfgWaitTime
@@ -93,6 +103,11 @@ namespace lfg
         // Find new group
         uint8 FindGroups();
 
+        // Rejects a combination from the precomputed queue data of its entries (nullptr terminated) only.
+        // LFG_COMPATIBLES_WITH_LESS_PLAYERS means the full role and dungeon check is still needed,
+        // dungeonMask then holds the common dungeons if dungeonsFromMask is set.
+        static LfgCompatibility CheckQueueDataCompatibility(std::array<LfgQueueData*, 5> const& queues, LfgDungeonMask& dungeonMask, bool& dungeonsFromMask);
+
     private:
         void SetQueueUpdateData(std::string const& strGuids, LfgRolesMap const& proposalRoles);
 
@@ -103,7 +118,7 @@ namespace lfg
         void AddToCompatibles(Lfg5Guids const& key);
 
         uint32 FindBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue);
-        void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, Lfg5Guids const& key);
+        void UpdateBestCompatibleInQueue(LfgQueueData& queueData, Lfg5Guids const& key);
 
         LfgCompatibility FindNewGroups(const WOWGUID& newGuid);
         LfgCompatibility CheckCompatibility(Lfg5Guids const& checkWith, const WOWGUID& newGuid, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles);
@@ -38,6 +38,7 @@
 #include "Player.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
+#include "ScriptProfiler.h"
 #include "ScriptedGossip.h"
 #include "SpellAuraEffects.h"
 #include "SpellMgr.h"
@@ -816,7 +817,10 @@ void Creature::Update(uint32 diff)
             {
                 // do not allow the AI to be changed during update
                 m_AI_locked = true;
-                i_AI->UpdateAI(diff);
+                {
+                    SCRIPT_PROFILE_SCOPE(ScriptProfileCategory::CreatureAI, GetEntry(), nullptr, "UpdateAI");
+                    i_AI->UpdateAI(diff);
+                }
                 m_AI_locked = false;
             }
 
@@ -2029,7 +2033,7 @@ void Creature::Respawn(bool force)
         }
     }
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_RESPAWN, GetEntry());
+    ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_RESPAWN, GetEntry());
 
     if (!sConditionMgr->IsObjectMeetToConditions(this, conditions) && !force)
     {
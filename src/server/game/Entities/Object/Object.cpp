@@ -1744,7 +1744,7 @@ bool WorldObject::CanSeeOrDetect(WorldObject const* obj, bool ignoreStealth, boo
                 return false;
             }
 
-            ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_VISIBILITY, cObj->GetEntry());
+            ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_VISIBILITY, cObj->GetEntry());
             if (!sConditionMgr->IsObjectMeetToConditions((WorldObject*)this, (WorldObject*)obj, conditions))
             {
                 return false;
@@ -2086,13 +2086,41 @@ void WorldObject::SendMessageToSet(WDataStore const* data, bool self) const
 void WorldObject::SendMessageToSetInRange(WDataStore const* data, float dist, bool /*self*/) const
 {
     Acore::MessageDistDeliverer notifier(this, data, dist);
-    Cell::VisitWorldObjects(this, notifier, dist);
+    SendMessageToClientObservers(notifier, dist);
 }
 
 void WorldObject::SendMessageToSet(WDataStore const* data, Player const* skipped_rcvr) const
 {
     Acore::MessageDistDeliverer notifier(this, data, GetVisibilityRange(), false, skipped_rcvr);
-    Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
+    SendMessageToClientObservers(notifier, GetVisibilityRange());
+}
+
+void WorldObject::SendMessageToClientObservers(Acore::MessageDistDeliverer& notifier, float dist) const
+{
+    // Motion transports are at every client without being tracked in its visible objects, search the grid for them
+    if (GameObject const* gameobject = ToGameObject())
+    {
+        if (gameobject->IsMotionTransport())
+        {
+            Cell::VisitWorldObjects(this, notifier, dist);
+            return;
+        }
+    }
+
+    // Only players that have the object at their client can receive the message, which is exactly the observer set
+    for (GuidUnorderedSet::iterator itr = _clientObservers.begin(); itr != _clientObservers.end();)
+    {
+        Player* observer = ObjectAccessor::GetPlayer(*this, *itr);
+        if (!observer || !observer->HaveAtClient(this))
+        {
+            // left the map, logged out or lost sight of the object without unregistering
+            itr = _clientObservers.erase(itr);
+            continue;
+        }
+
+        ++itr;
+        notifier.VisitObserver(observer);
+    }
 }
 
 void WorldObject::SendObjectDeSpawnAnim(WOWGUID guid)
@@ -2959,7 +2987,7 @@ void WorldObject::DestroyForNearbyPlayers()
             continue;
 
         DestroyForPlayer(player);
-        player->m_clientGUIDs.erase(GetGUID());
+        player->RemoveClientGUID(this);
     }
 }
 
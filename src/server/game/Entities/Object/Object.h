@@ -40,6 +40,11 @@
 
 class ElunaEventProcessor;
 
+namespace Acore
+{
+    struct MessageDistDeliverer;
+}
+
 enum TempSummonType
 {
     TEMPSUMMON_TIMED_OR_DEAD_DESPAWN       = 1,             // despawns after a specified time OR when the creature disappears
@@ -484,6 +489,12 @@ public:
     virtual void SendMessageToSetInRange(WDataStore const* data, float dist, bool self) const;
     virtual void SendMessageToSet(WDataStore const* data, Player const* skipped_rcvr) const;
 
+    // players that have this object at their client, kept by Player::AddClientGUID / Player::RemoveClientGUID
+    void AddClientObserver(WOWGUID guid) { _clientObservers.insert(guid); }
+    void RemoveClientObserver(WOWGUID guid) { _clientObservers.erase(guid); }
+    //! Delivers a broadcast to the client observers of this object instead of searching the grid for receivers
+    void SendMessageToClientObservers(Acore::MessageDistDeliverer& notifier, float dist) const;
+
     virtual uint8 getLevelForTarget(WorldObject const* /*target*/) const { return 1; }
 
     void PlayDistanceSound(uint32 sound_id, Player* target = nullptr);
@@ -676,6 +687,9 @@ private:
     bool CanDetectStealthOf(WorldObject const* obj, bool checkAlert = false) const;
 
     GuidUnorderedSet _allowedLooters;
+
+    // pruned lazily while broadcasting, see SendMessageToClientObservers()
+    mutable GuidUnorderedSet _clientObservers;
 };
 
 namespace Acore
@@ -30,6 +30,7 @@
 #define TRADE_DISTANCE               11.11f
 #define MAX_VISIBILITY_DISTANCE      250.0f                 // max distance for visible objects, experimental
 #define SIGHT_RANGE_UNIT             50.0f
+#define AI_RELOCATION_NOTIFY_DISTANCE 60.0f                 // range of the delayed MoveInLineOfSight notifies, see Map::HandleDelayedAINotify()
 #define MAX_SEARCHER_DISTANCE        150.0f                 // pussywizard: replace the use of MAX_VISIBILITY_DISTANCE in searchers, because MAX_VISIBILITY_DISTANCE is quite too big for this purpose
 #define VISIBILITY_DISTANCE_INFINITE 533.0f
 #define VISIBILITY_DISTANCE_GIGANTIC 400.0f
@@ -46,6 +46,7 @@
 #include "Log.h"
 #include "LootItemStorage.h"
 #include "MapMgr.h"
+#include "Metric.h"
 #include "MiscPackets.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
@@ -71,6 +72,7 @@
 #include "User.h"
 #include "Vehicle.h"
 #include "MapWeather.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WDataStore.h"
 #include "WowConnectionNet.h"
@@ -215,6 +217,9 @@ Player::Player(class User* user): Unit(true), m_mover(this)
     // group is initialized in the reference constructor
     SetGroupInvite(nullptr);
     m_groupUpdateMask = 0;
+    m_groupUpdateTimer = 0;
+    m_groupUpdateMerged = 0;
+    m_groupUpdateChanged = false;
     m_auraRaidUpdateMask = 0;
     m_bPassOnGroupLoot = false;
 
@@ -289,6 +294,8 @@ Player::Player(class User* user): Unit(true), m_mover(this)
     ////////////////////Rest System/////////////////////
 
     m_mailsUpdated = false;
+    m_mailItemsLoaded = false;
+    m_mailItemsLoading = false;
     unReadMails = 0;
     m_nextMailDelivereTime = time_t(0);
 
@@ -2337,6 +2344,8 @@ void Player::SetGMVisible(bool on)
         m_ExtraFlags |= PLAYER_EXTRA_GM_INVISIBLE;
         m_serverSideVisibility.SetValue(SERVERSIDE_VISIBILITY_GM, User()->GetSecurity());
     }
+
+    sWhoListCacheMgr->UpdatePlayer(this);
 }
 
 bool Player::IsGroupVisibleFor(Player const* p) const
@@ -2884,17 +2893,36 @@ void Player::SendInitialSpells()
     User()->Send(&data);
 }
 
+void Player::AddMail(Mail* mail)
+{
+    m_mail.push_front(mail);
+    m_mailsById[mail->messageID] = mail;
+}
+
 void Player::RemoveMail(uint32 id)
 {
-    for (PlayerMails::iterator itr = m_mail.begin(); itr != m_mail.end(); ++itr)
-    {
-        if ((*itr)->messageID == id)
-        {
-            //do not delete item, because Player::removeMail() is called when returning mail to sender.
-            m_mail.erase(itr);
-            return;
-        }
-    }
+    auto mailItr = m_mailsById.find(id);
+    if (mailItr == m_mailsById.end())
+        return;
+
+    Mail* mail = mailItr->second;
+    m_mailsById.erase(mailItr);
+
+    // the caller owns the mail from now on, a pending save must not touch it anymore
+    if (mail->state != MAIL_STATE_UNCHANGED)
+        m_changedMails.erase(std::remove(m_changedMails.begin(), m_changedMails.end(), mail), m_changedMails.end());
+
+    //do not delete item, because Player::removeMail() is called when returning mail to sender.
+    m_mail.erase(std::find(m_mail.begin(), m_mail.end(), mail));
+}
+
+void Player::SetMailState(Mail* mail, MailState state)
+{
+    if (mail->state == MAIL_STATE_UNCHANGED && state != MAIL_STATE_UNCHANGED)
+        m_changedMails.push_back(mail);
+
+    mail->state = state;
+    m_mailsUpdated = true;
 }
 
 void Player::SendMailResult(uint32 mailId, MailResponseType mailAction, MailResponseResult mailError, uint32 equipError, WOWGUID::LowType item_guid, uint32 item_count)
@@ -3831,14 +3859,8 @@ void Player::SetFreeTalentPoints(uint32 points)
 
 Mail* Player::GetMail(uint32 id)
 {
-    for (PlayerMails::iterator itr = m_mail.begin(); itr != m_mail.end(); ++itr)
-    {
-        if ((*itr)->messageID == id)
-        {
-            return (*itr);
-        }
-    }
-    return nullptr;
+    auto itr = m_mailsById.find(id);
+    return itr != m_mailsById.end() ? itr->second : nullptr;
 }
 
 void Player::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target)
@@ -5665,7 +5687,7 @@ void Player::SendMessageToSetInRange(WDataStore const* data, float dist, bool se
         User()->Send(data);
 
     Acore::MessageDistDeliverer notifier(this, data, dist);
-    Cell::VisitWorldObjects(this, notifier, dist);
+    SendMessageToClientObservers(notifier, dist);
 }
 
 void Player::SendMessageToSetInRange(WDataStore const* data, float dist, bool self, bool includeMargin, bool ownTeamOnly, bool required3dDist) const
@@ -5678,7 +5700,7 @@ void Player::SendMessageToSetInRange(WDataStore const* data, float dist, bool se
         dist += VISIBILITY_COMPENSATION; // pussywizard: to ensure everyone receives all important packets
 
     Acore::MessageDistDeliverer notifier(this, data, dist, ownTeamOnly, nullptr, required3dDist);
-    Cell::VisitWorldObjects(this, notifier, dist);
+    SendMessageToClientObservers(notifier, dist);
 }
 
 void Player::SendMessageToSet(WDataStore const* data, Player const* skipped_rcvr) const
@@ -5687,7 +5709,7 @@ void Player::SendMessageToSet(WDataStore const* data, Player const* skipped_rcvr
         User()->Send(data);
 
     Acore::MessageDistDeliverer notifier(this, data, GetVisibilityRange(), false, skipped_rcvr);
-    Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
+    SendMessageToClientObservers(notifier, GetVisibilityRange());
 }
 
 void Player::SendDirectMessage(WDataStore const* data) const
@@ -9615,7 +9637,7 @@ void Player::VehicleSpellInitialize()
             continue;
         }
 
-        ConditionList conditions = sConditionMgr->GetConditionsForVehicleSpell(vehicle->GetEntry(), spellId);
+        ConditionList const& conditions = sConditionMgr->GetConditionsForVehicleSpell(vehicle->GetEntry(), spellId);
         if (!sConditionMgr->IsObjectMeetToConditions(this, vehicle, conditions))
         {
             LOG_DEBUG("condition", "VehicleSpellInitialize: conditions not met for Vehicle entry {} spell {}", vehicle->ToCreature()->GetEntry(), spellId);
@@ -10772,7 +10794,7 @@ bool Player::BuyItemFromVendorSlot(WOWGUID vendorguid, uint32 vendorslot, uint32
         return false;
     }
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), item);
+    ConditionList const& conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), item);
     if (!sConditionMgr->IsObjectMeetToConditions(this, creature, conditions))
     {
         //LOG_DEBUG("condition", "BuyItemFromVendor: conditions not met for creature entry {} item {}", creature->GetEntry(), item);
@@ -11457,6 +11479,37 @@ bool Player::HaveAtClient(WOWGUID guid) const
     return m_clientGUIDs.find(guid) != m_clientGUIDs.end();
 }
 
+void Player::AddClientGUID(WorldObject* target)
+{
+    m_clientGUIDs.insert(target->GetGUID());
+    target->AddClientObserver(GetGUID());
+}
+
+void Player::RemoveClientGUID(WorldObject* target)
+{
+    m_clientGUIDs.erase(target->GetGUID());
+    target->RemoveClientObserver(GetGUID());
+}
+
+void Player::RemoveClientGUID(WOWGUID guid)
+{
+    if (!m_clientGUIDs.erase(guid))
+        return;
+
+    if (WorldObject* target = ObjectAccessor::GetWorldObject(*this, guid))
+        target->RemoveClientObserver(GetGUID());
+}
+
+void Player::ClearClientGUIDs()
+{
+    // objects no longer on our map are pruned by WorldObject::SendMessageToClientObservers()
+    for (WOWGUID const& guid : m_clientGUIDs)
+        if (WorldObject* target = ObjectAccessor::GetWorldObject(*this, guid))
+            target->RemoveClientObserver(GetGUID());
+
+    m_clientGUIDs.clear();
+}
+
 bool Player::IsNeverVisible() const
 {
     if (Unit::IsNeverVisible())
@@ -11717,13 +11770,49 @@ void Player::SendInitialPacketsAfterAddToMap()
         SendRaidDifficulty(GetGroup() != nullptr);
 }
 
+void Player::UpdateGroupMemberStats(uint32 diff)
+{
+    if (m_groupUpdateTimer > diff)
+        m_groupUpdateTimer -= diff;
+    else
+        m_groupUpdateTimer = 0;
+
+    if (m_groupUpdateMask == GROUP_UPDATE_FLAG_NONE)
+        return;
+
+    // keep collecting, every player update with changes would have cost one packet per out of range member
+    if (m_groupUpdateTimer)
+    {
+        if (m_groupUpdateChanged)
+        {
+            ++m_groupUpdateMerged;
+            m_groupUpdateChanged = false;
+        }
+        return;
+    }
+
+    SendUpdateToOutOfRangeGroupMembers();
+    m_groupUpdateTimer = sWorld->getIntConfig(CONFIG_GROUP_MEMBER_STATS_UPDATE_INTERVAL);
+}
+
 void Player::SendUpdateToOutOfRangeGroupMembers()
 {
     if (m_groupUpdateMask == GROUP_UPDATE_FLAG_NONE)
         return;
+
+    uint32 sentPackets = 0;
     if (Group* group = GetGroup())
-        group->UpdatePlayerOutOfRange(this);
+        sentPackets = group->UpdatePlayerOutOfRange(this);
 
+    if (sentPackets)
+    {
+        METRIC_VALUE("group_member_stats_packets", uint64(sentPackets));
+        if (m_groupUpdateMerged)
+            METRIC_VALUE("group_member_stats_packets_saved", uint64(sentPackets) * m_groupUpdateMerged);
+    }
+
+    m_groupUpdateMerged = 0;
+    m_groupUpdateChanged = false;
     m_groupUpdateMask = GROUP_UPDATE_FLAG_NONE;
     m_auraRaidUpdateMask = 0;
     if (Pet* pet = GetPet())
@@ -14321,7 +14410,7 @@ bool Player::CanSeeSpellClickOn(Creature const* c) const
         if (!itr->second.IsFitToRequirements(this, c))
             return false;
 
-        ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(c->GetEntry(), itr->second.spellId);
+        ConditionList const& conds = sConditionMgr->GetConditionsForSpellClickEvent(c->GetEntry(), itr->second.spellId);
         ConditionSourceInfo info = ConditionSourceInfo(const_cast<Player*>(this), const_cast<Creature*>(c));
         if (sConditionMgr->IsObjectMeetToConditions(info, conds))
             return true;
@@ -14335,7 +14424,7 @@ bool Player::CanSeeVendor(Creature const* creature) const
     if (!creature->HasNpcFlag(UNIT_NPC_FLAG_VENDOR))
         return true;
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), 0);
+    ConditionList const& conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), 0);
     if (!sConditionMgr->IsObjectMeetToConditions(const_cast<Player*>(this), const_cast<Creature*>(creature), conditions))
     {
         return false;
@@ -15430,6 +15519,8 @@ void Player::SetIsSpectator(bool on)
             }
         }
     }
+
+    sWhoListCacheMgr->UpdatePlayer(this);
 }
 
 bool Player::NeedSendSpectatorData() const
@@ -16018,6 +16109,14 @@ bool Player::SetFeatherFall(bool apply, bool packetOnly /*= false*/)
     return true;
 }
 
+void Player::SetInGuild(uint32 GuildId)
+{
+    SetUInt32Value(PLAYER_GUILDID, GuildId);
+    // xinef: update global storage
+    sCharacterCache->UpdateCharacterGuildId(GetGUID(), GetGuildId());
+    sWhoListCacheMgr->UpdatePlayer(this);
+}
+
 Guild* Player::GetGuild() const
 {
     uint32 guildId = GetGuildId();
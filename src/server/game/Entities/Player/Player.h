@@ -1653,11 +1653,19 @@ public:
 
     void RemoveMail(uint32 id);
 
-    void AddMail(Mail* mail) { m_mail.push_front(mail); }// for call from User::SendMailTo
+    void AddMail(Mail* mail);                           // for call from User::SendMailTo
     uint32 GetMailSize() { return m_mail.size();}
     Mail* GetMail(uint32 id);
+    // Changes the mail state and queues the mail for the next _SaveMail(), which only writes queued mails
+    void SetMailState(Mail* mail, MailState state);
 
     [[nodiscard]] PlayerMails const& GetMails() const { return m_mail; }
+
+    // Mailed item bodies are loaded the first time the mailbox is listed, the login only loads which items each mail holds
+    [[nodiscard]] bool HasMailItemsLoaded() const { return m_mailItemsLoaded; }
+    [[nodiscard]] bool IsMailItemsLoading() const { return m_mailItemsLoading; }
+    void SetMailItemsLoading() { m_mailItemsLoading = true; }
+    void _LoadMailItems(PreparedQueryResult mailItemsResult);
     void SendItemRetrievalMail(uint32 itemEntry, uint32 count); // Item retrieval mails sent by The Postmaster (34337)
     void SendItemRetrievalMail(std::vector<std::pair<uint32, uint32>> mailItems); // Item retrieval mails sent by The Postmaster (34337)
 
@@ -1888,13 +1896,9 @@ public:
     static void RemoveFromGroup(Group* group, WOWGUID guid, RemoveMethod method = GROUP_REMOVEMETHOD_DEFAULT, WOWGUID kicker = WOWGUID::Empty, const char* reason = nullptr);
     void RemoveFromGroup(RemoveMethod method = GROUP_REMOVEMETHOD_DEFAULT) { RemoveFromGroup(GetGroup(), GetGUID(), method); }
     void SendUpdateToOutOfRangeGroupMembers();
+    void UpdateGroupMemberStats(uint32 diff);
 
-    void SetInGuild(uint32 GuildId)
-    {
-        SetUInt32Value(PLAYER_GUILDID, GuildId);
-        // xinef: update global storage
-        sCharacterCache->UpdateCharacterGuildId(GetGUID(), GetGuildId());
-    }
+    void SetInGuild(uint32 GuildId);
     void SetRank(uint8 rankId) { SetUInt32Value(PLAYER_GUILDRANK, rankId); }
     [[nodiscard]] uint8 GetRank() const { return uint8(GetUInt32Value(PLAYER_GUILDRANK)); }
     void SetGuildIdInvited(uint32 GuildId) { m_GuildIdInvited = GuildId; }
@@ -2390,6 +2394,11 @@ public:
 
     [[nodiscard]] bool HaveAtClient(WorldObject const* u) const;
     [[nodiscard]] bool HaveAtClient(WOWGUID guid) const;
+    //! Marks an object as present at the client and registers the player as its observer for broadcasts
+    void AddClientGUID(WorldObject* target);
+    void RemoveClientGUID(WorldObject* target);
+    void RemoveClientGUID(WOWGUID guid);
+    void ClearClientGUIDs();
 
     [[nodiscard]] bool IsNeverVisible() const override;
 
@@ -2478,7 +2487,7 @@ public:
     void SetGroup(Group* group, int8 subgroup = -1);
     [[nodiscard]] uint8 GetSubGroup() const { return m_group.getSubGroup(); }
     [[nodiscard]] uint32 GetGroupUpdateFlag() const { return m_groupUpdateMask; }
-    void SetGroupUpdateFlag(uint32 flag) { m_groupUpdateMask |= flag; }
+    void SetGroupUpdateFlag(uint32 flag) { m_groupUpdateMask |= flag; m_groupUpdateChanged = true; }
     [[nodiscard]] uint64 GetAuraUpdateMaskForRaid() const { return m_auraRaidUpdateMask; }
     void SetAuraUpdateMaskForRaid(uint8 slot) { m_auraRaidUpdateMask |= (uint64(1) << slot); }
     Player* GetNextRandomRaidMember(float radius);
@@ -2801,6 +2810,10 @@ public:
     uint32 m_ArenaTeamIdInvited;
 
     PlayerMails m_mail;
+    std::unordered_map<uint32, Mail*> m_mailsById;
+    std::vector<Mail*> m_changedMails;                  // mails with a state other than MAIL_STATE_UNCHANGED
+    bool m_mailItemsLoaded;
+    bool m_mailItemsLoading;
     PlayerSpellMap m_spells;
     PlayerTalentMap m_talents;
     uint32 m_lastPotionId;                              // last used health/mana potion in combat, that block next potion use
@@ -2889,6 +2902,9 @@ public:
     GroupReference m_originalGroup;
     Group* m_groupInvite;
     uint32 m_groupUpdateMask;
+    uint32 m_groupUpdateTimer;                          // changes are merged into one update until it expires
+    uint32 m_groupUpdateMerged;                         // player updates whose changes were merged into the next send
+    bool m_groupUpdateChanged;
     uint64 m_auraRaidUpdateMask;
     bool m_bPassOnGroupLoot;
 
@@ -6164,8 +6164,7 @@ void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mail
     time_t cur_time = GameTime::GetGameTime().count();
 
     m_mail.clear();
-
-    std::unordered_map<uint32, Mail*> mailById;
+    m_mailsById.clear();
 
     if (mailsResult)
     {
@@ -6191,6 +6190,7 @@ void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mail
             if (cur_time > m->expire_time)
             {
                 LOG_DEBUG("entities.player", "Player::_LoadMail: Mail ({}) has expired - ignored.", m->messageID);
+                delete m;
                 continue;
             }
 
@@ -6203,23 +6203,55 @@ void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mail
             m->state = MAIL_STATE_UNCHANGED;
 
             m_mail.push_back(m);
-            mailById[m->messageID] = m;
+            m_mailsById[m->messageID] = m;
         } while (mailsResult->NextRow());
     }
 
+    // mailItemsResult only holds the item guid and entry, see _LoadMailItems() for the items themselves
     if (mailItemsResult)
     {
         do
         {
             Field* fields = mailItemsResult->Fetch();
-            uint32 mailId = fields[14].Get<uint32>();
-            _LoadMailedItem(GetGUID(), this, mailId, mailById[mailId], fields);
+            if (Mail* mail = GetMail(fields[0].Get<uint32>()))
+                mail->AddItem(fields[1].Get<uint32>(), fields[2].Get<uint32>());
         } while (mailItemsResult->NextRow());
     }
 
     UpdateNextMailTimeAndUnreads();
 }
 
+void Player::_LoadMailItems(PreparedQueryResult mailItemsResult)
+{
+    m_mailItemsLoading = false;
+    m_mailItemsLoaded = true;
+
+    if (!mailItemsResult)
+        return;
+
+    do
+    {
+        Field* fields = mailItemsResult->Fetch();
+        WOWGUID::LowType itemGuid = fields[11].Get<uint32>();
+        uint32 mailId = fields[14].Get<uint32>();
+
+        // items of mails delivered since the login are already there
+        if (GetMItem(itemGuid))
+            continue;
+
+        // mails which are not delivered yet, or got deleted since the login
+        Mail* mail = GetMail(mailId);
+        if (!mail || mail->state == MAIL_STATE_DELETED)
+            continue;
+
+        if (std::none_of(mail->items.begin(), mail->items.end(), [itemGuid](MailItemInfo const& info) { return info.item_guid == itemGuid; }))
+            continue;
+
+        if (!_LoadMailedItem(GetGUID(), this, mailId, nullptr, fields))
+            mail->RemoveItem(itemGuid);
+    } while (mailItemsResult->NextRow());
+}
+
 void Player::LoadPet()
 {
     //fixme: the pet should still be loaded if the player is not in world
@@ -7391,10 +7423,11 @@ void Player::_SaveMail(CharacterDatabaseTransaction trans)
     }
 
     CharacterDatabasePreparedStatement* stmt = nullptr;
+    bool hasDeletedMails = false;
 
-    for (PlayerMails::iterator itr = m_mail.begin(); itr != m_mail.end(); ++itr)
+    // only the mails which changed since the last save
+    for (Mail* m : m_changedMails)
     {
-        Mail* m = (*itr);
         if (m->state == MAIL_STATE_CHANGED)
         {
             stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL);
@@ -7438,21 +7471,25 @@ void Player::_SaveMail(CharacterDatabaseTransaction trans)
             stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_ITEM_BY_ID);
             stmt->SetData(0, m->messageID);
             trans->Append(stmt);
+
+            m_mailsById.erase(m->messageID);
+            hasDeletedMails = true;
         }
     }
 
+    m_changedMails.clear();
+
     //deallocate deleted mails...
-    for (PlayerMails::iterator itr = m_mail.begin(); itr != m_mail.end();)
+    if (hasDeletedMails)
     {
-        if ((*itr)->state == MAIL_STATE_DELETED)
+        m_mail.erase(std::remove_if(m_mail.begin(), m_mail.end(), [](Mail* m)
         {
-            Mail* m = *itr;
-            m_mail.erase(itr);
+            if (m->state != MAIL_STATE_DELETED)
+                return false;
+
             delete m;
-            itr = m_mail.begin();
-        }
-        else
-            ++itr;
+            return true;
+        }), m_mail.end());
     }
 
     m_mailsUpdated = false;
@@ -7702,16 +7739,9 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
 {
     CharacterDatabasePreparedStatement* stmt = nullptr;
 
-    for (PlayerSpellMap::iterator itr = m_spells.begin(); itr != m_spells.end();)
+    // Delete statements for removed / updated spells go first, so the inserts below form a single run that can be batched
+    for (PlayerSpellMap::const_iterator itr = m_spells.begin(); itr != m_spells.end(); ++itr)
     {
-        // xinef: skip temporary spells
-        if (itr->second->State == PLAYERSPELL_TEMPORARY)
-        {
-            ++itr;
-            continue;
-        }
-
-        // xinef: Delete statement for removed / updated spell
         if (itr->second->State == PLAYERSPELL_REMOVED || itr->second->State == PLAYERSPELL_CHANGED)
         {
             stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_BY_SPELL);
@@ -7719,6 +7749,16 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
             stmt->SetData(1, itr->first);
             trans->Append(stmt);
         }
+    }
+
+    for (PlayerSpellMap::iterator itr = m_spells.begin(); itr != m_spells.end();)
+    {
+        // xinef: skip temporary spells
+        if (itr->second->State == PLAYERSPELL_TEMPORARY)
+        {
+            ++itr;
+            continue;
+        }
 
         // xinef: insert statement for new / updated spell
         if (itr->second->State == PLAYERSPELL_NEW || itr->second->State == PLAYERSPELL_CHANGED)
@@ -37,6 +37,7 @@
 #include "UpdateFieldFlags.h"
 #include "Vehicle.h"
 #include "MapWeather.h"
+#include "WhoListCacheMgr.h"
 #include "WorldStatePackets.h"
 
 /// @todo: this import is not necessary for compilation and marked as unused by the IDE
@@ -319,9 +320,15 @@ void Player::Update(uint32 p_time)
     {
         if (p_time >= m_nextSave)
         {
-            // m_nextSave reset in SaveToDB call
-            SaveToDB(false, false);
-            LOG_DEBUG("entities.player", "Player::Update: Player '{}' ({}) saved", GetName(), GetGUID().ToString());
+            // Character database is backlogged, autosaves can wait for the queue to drain
+            if (CharacterDatabase.ShouldDefer())
+                m_nextSave = urand(5 * IN_MILLISECONDS, 15 * IN_MILLISECONDS);
+            else
+            {
+                // m_nextSave reset in SaveToDB call
+                SaveToDB(false, false);
+                LOG_DEBUG("entities.player", "Player::Update: Player '{}' ({}) saved", GetName(), GetGUID().ToString());
+            }
         }
         else
         {
@@ -382,7 +389,7 @@ void Player::Update(uint32 p_time)
     }
 
     // group update
-    SendUpdateToOutOfRangeGroupMembers();
+    UpdateGroupMemberStats(p_time);
 
     Pet* pet = GetPet();
     if (pet && !pet->IsWithinDistInMap(this, GetMap()->GetVisibilityRange()) &&
@@ -1221,6 +1228,8 @@ void Player::UpdateZone(uint32 newZone, uint32 newArea)
                                       // just area change, works strange...
         if (Guild* guild = GetGuild())
             guild->UpdateMemberData(this, GUILD_MEMBER_DATA_ZONEID, newZone);
+
+        sWhoListCacheMgr->UpdatePlayer(this);
     }
 
     // group update
@@ -1584,35 +1593,35 @@ void Player::UpdateObjectVisibility(bool forced, bool fromUpdate)
 }
 
 template <class T>
-inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, T* target,
+inline void UpdateVisibilityOf_helper(Player* player, T* target,
                                       std::vector<Unit*>& /*v*/)
 {
-    s64.insert(target->GetGUID());
+    player->AddClientGUID(target);
 }
 
 template <>
-inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, GameObject* target,
+inline void UpdateVisibilityOf_helper(Player* player, GameObject* target,
                                       std::vector<Unit*>& /*v*/)
 {
     // @HACK: This is to prevent objects like deeprun tram from disappearing
     // when player moves far from its spawn point while riding it
     if ((target->GetGOInfo()->type != GAMEOBJECT_TYPE_TRANSPORT))
-        s64.insert(target->GetGUID());
+        player->AddClientGUID(target);
 }
 
 template <>
-inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, Creature* target,
+inline void UpdateVisibilityOf_helper(Player* player, Creature* target,
                                       std::vector<Unit*>& v)
 {
-    s64.insert(target->GetGUID());
+    player->AddClientGUID(target);
     v.push_back(target);
 }
 
 template <>
-inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, Player* target,
+inline void UpdateVisibilityOf_helper(Player* player, Player* target,
                                       std::vector<Unit*>& v)
 {
-    s64.insert(target->GetGUID());
+    player->AddClientGUID(target);
     v.push_back(target);
 }
 
@@ -1639,7 +1648,7 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data,
             BeforeVisibilityDestroy<T>(target, this);
 
             target->BuildOutOfRangeUpdateBlock(&data);
-            m_clientGUIDs.erase(target->GetGUID());
+            RemoveClientGUID(target);
         }
     }
     else
@@ -1647,7 +1656,7 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data,
         if (CanSeeOrDetect(target, false, true))
         {
             target->BuildCreateUpdateBlockForPlayer(&data, this);
-            UpdateVisibilityOf_helper(m_clientGUIDs, target, visibleNow);
+            UpdateVisibilityOf_helper(this, target, visibleNow);
         }
     }
 }
@@ -1673,7 +1682,7 @@ void Player::UpdateVisibilityOf(WorldObject* target)
                 BeforeVisibilityDestroy<Creature>(target->ToCreature(), this);
 
             target->DestroyForPlayer(this);
-            m_clientGUIDs.erase(target->GetGUID());
+            RemoveClientGUID(target);
         }
     }
     else
@@ -1681,7 +1690,7 @@ void Player::UpdateVisibilityOf(WorldObject* target)
         if (CanSeeOrDetect(target, false, true))
         {
             target->SendUpdateToPlayer(this);
-            m_clientGUIDs.insert(target->GetGUID());
+            AddClientGUID(target);
 
             // target aura duration for caster show only if target exist at
             // caster client send data at target visibility change (adding to
@@ -1766,7 +1775,7 @@ void Player::UpdateForQuestWorldObjects()
                 {
                     //! This code doesn't look right, but it was logically converted to condition system to do the exact
                     //! same thing it did before. It definitely needs to be overlooked for intended functionality.
-                    ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(obj->GetEntry(), _itr->second.spellId);
+                    ConditionList const& conds = sConditionMgr->GetConditionsForSpellClickEvent(obj->GetEntry(), _itr->second.spellId);
                     bool buildUpdateBlock = false;
                     for (ConditionList::const_iterator jtr = conds.begin(); jtr != conds.end() && !buildUpdateBlock; ++jtr)
                         if ((*jtr)->ConditionType == CONDITION_QUESTREWARDED || (*jtr)->ConditionType == CONDITION_QUESTTAKEN)
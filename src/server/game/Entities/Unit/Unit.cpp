@@ -66,6 +66,7 @@
 #include "UpdateFieldFlags.h"
 #include "Util.h"
 #include "Vehicle.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WDataStore.h"
 #include <math.h>
@@ -410,7 +411,7 @@ void Unit::Update(uint32 p_time)
             if (m_delayed_unit_ai_notify_timer <= p_time)
             {
                 m_delayed_unit_ai_notify_timer = 0;
-                ExecuteDelayedUnitAINotifyEvent();
+                FindMap()->i_objectsForDelayedAINotify.insert(this);
             }
             else
                 m_delayed_unit_ai_notify_timer -= p_time;
@@ -15413,6 +15414,7 @@ void Unit::SetLevel(uint8 lvl, bool showLevelChange)
     if (IsPlayer())
     {
         sCharacterCache->UpdateCharacterLevel(GetGUID(), lvl);
+        sWhoListCacheMgr->UpdatePlayer(ToPlayer());
     }
 }
 
@@ -16129,7 +16131,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         }
 
         // do checks using conditions table
-        ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL_PROC, spellProto->Id);
+        ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL_PROC, spellProto->Id);
         ConditionSourceInfo condInfo = ConditionSourceInfo(eventInfo.GetActor(), eventInfo.GetActionTarget());
         if (!sConditionMgr->IsObjectMeetToConditions(condInfo, conditions))
         {
@@ -19491,7 +19493,7 @@ bool Unit::HandleSpellClick(Unit* clicker, int8 seatId)
             continue;
 
         //! Check database conditions
-        ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(spellClickEntry, itr->second.spellId);
+        ConditionList const& conds = sConditionMgr->GetConditionsForSpellClickEvent(spellClickEntry, itr->second.spellId);
         ConditionSourceInfo info = ConditionSourceInfo(clicker, this);
         if (!sConditionMgr->IsObjectMeetToConditions(info, conds))
             continue;
@@ -20431,8 +20433,7 @@ void Unit::ExecuteDelayedUnitAINotifyEvent()
         return;
 
     Acore::AIRelocationNotifier notifier(*this);
-    float radius = 60.0f;
-    Cell::VisitAllObjects(this, notifier, radius);
+    Cell::VisitAllObjects(this, notifier, AI_RELOCATION_NOTIFY_DISTANCE);
 }
 
 void Unit::SetInFront(WorldObject const* target)
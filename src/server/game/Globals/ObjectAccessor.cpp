@@ -39,26 +39,29 @@ void HashMapHolder<T>::Insert(T* o)
         || std::is_same<MotionTransport, T>::value,
         "Only Player and Motion Transport can be registered in global HashMapHolder");
 
-    std::unique_lock<std::shared_mutex> lock(*GetLock());
+    {
+        std::unique_lock<std::shared_mutex> lock(*GetLock());
+        GetContainer()[o->GetGUID()] = o;
+    }
 
-    GetContainer()[o->GetGUID()] = o;
+    GetShards().Insert(o->GetGUID(), o);
 }
 
 template<class T>
 void HashMapHolder<T>::Remove(T* o)
 {
-    std::unique_lock<std::shared_mutex> lock(*GetLock());
+    {
+        std::unique_lock<std::shared_mutex> lock(*GetLock());
+        GetContainer().erase(o->GetGUID());
+    }
 
-    GetContainer().erase(o->GetGUID());
+    GetShards().Remove(o->GetGUID());
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(WOWGUID guid)
 {
-    std::shared_lock<std::shared_mutex> lock(*GetLock());
-
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+    return GetShards().Find(guid);
 }
 
 template<class T>
@@ -75,6 +78,19 @@ std::shared_mutex* HashMapHolder<T>::GetLock()
     return &_lock;
 }
 
+template<class T>
+ShardedLookupMap<WOWGUID, T*>& HashMapHolder<T>::GetShards()
+{
+    static ShardedLookupMap<WOWGUID, T*> _shards;
+    return _shards;
+}
+
+template<class T>
+uint64 HashMapHolder<T>::GetContendedReads()
+{
+    return GetShards().GetContendedReads();
+}
+
 HashMapHolder<Player>::MapType const& ObjectAccessor::GetPlayers()
 {
     return HashMapHolder<Player>::GetContainer();
@@ -85,22 +101,22 @@ template class HashMapHolder<MotionTransport>;
 
 namespace PlayerNameMapHolder
 {
-    typedef std::unordered_map<std::string, Player*> MapType;
-    static MapType PlayerNameMap;
+    // keyed by the normalized (case folded) character name
+    static ShardedLookupMap<std::string, Player*> PlayerNameMap;
 
     void Insert(Player* p)
     {
-        PlayerNameMap[p->GetName()] = p;
+        PlayerNameMap.Insert(p->GetName(), p);
     }
 
     void Remove(Player* p)
     {
-        PlayerNameMap.erase(p->GetName());
+        PlayerNameMap.Remove(p->GetName(), p);
     }
 
     void RemoveByName(std::string const& name)
     {
-        PlayerNameMap.erase(name);
+        PlayerNameMap.Remove(name);
     }
 
     Player* Find(std::string const& name)
@@ -109,8 +125,12 @@ namespace PlayerNameMapHolder
         if (!normalizePlayerName(charName))
             return nullptr;
 
-        auto itr = PlayerNameMap.find(charName);
-        return (itr != PlayerNameMap.end()) ? itr->second : nullptr;
+        return PlayerNameMap.Find(charName);
+    }
+
+    uint64 GetContendedReads()
+    {
+        return PlayerNameMap.GetContendedReads();
     }
 
 } // namespace PlayerNameMapHolder
@@ -351,3 +371,13 @@ void ObjectAccessor::UpdatePlayerNameMapReference(std::string oldname, Player* p
     PlayerNameMapHolder::RemoveByName(oldname);
     PlayerNameMapHolder::Insert(player);
 }
+
+uint64 ObjectAccessor::GetPlayerLookupContendedReads()
+{
+    return HashMapHolder<Player>::GetContendedReads();
+}
+
+uint64 ObjectAccessor::GetPlayerNameLookupContendedReads()
+{
+    return PlayerNameMapHolder::GetContendedReads();
+}
@@ -22,6 +22,8 @@
 #include "GridDefines.h"
 #include "Object.h"
 #include "UpdateData.h"
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <set>
 #include <shared_mutex>
@@ -40,6 +42,78 @@ class Transport;
 class StaticTransport;
 class MotionTransport;
 
+/**
+ * Hash map split into independently locked shards, each on its own cache line.
+ * Lookups of different keys take different locks, so concurrent readers on
+ * many threads do not bounce a single reader-writer lock between cores.
+ * Reads which had to wait for a writer are counted as contended.
+ */
+template<class Key, class Value, class Hash = std::hash<Key>>
+class ShardedLookupMap
+{
+public:
+    static constexpr std::size_t ShardCount = 64;
+
+    void Insert(Key const& key, Value value)
+    {
+        Shard& shard = GetShard(key);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+        shard.Map[key] = value;
+    }
+
+    void Remove(Key const& key)
+    {
+        Shard& shard = GetShard(key);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+        shard.Map.erase(key);
+    }
+
+    // removes the key only while it still maps to value
+    void Remove(Key const& key, Value value)
+    {
+        Shard& shard = GetShard(key);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+        auto itr = shard.Map.find(key);
+        if (itr != shard.Map.end() && itr->second == value)
+            shard.Map.erase(itr);
+    }
+
+    Value Find(Key const& key) const
+    {
+        Shard const& shard = GetShard(key);
+        std::shared_lock<std::shared_mutex> lock(shard.Lock, std::try_to_lock);
+        if (!lock.owns_lock())
+        {
+            shard.ContendedReads.fetch_add(1, std::memory_order_relaxed);
+            lock.lock();
+        }
+
+        auto itr = shard.Map.find(key);
+        return itr != shard.Map.end() ? itr->second : Value();
+    }
+
+    uint64 GetContendedReads() const
+    {
+        uint64 count = 0;
+        for (Shard const& shard : _shards)
+            count += shard.ContendedReads.load(std::memory_order_relaxed);
+        return count;
+    }
+
+private:
+    struct alignas(64) Shard
+    {
+        mutable std::shared_mutex Lock;
+        std::unordered_map<Key, Value, Hash> Map;
+        mutable std::atomic<uint64> ContendedReads{0};
+    };
+
+    Shard& GetShard(Key const& key) { return _shards[Hash()(key) % ShardCount]; }
+    Shard const& GetShard(Key const& key) const { return _shards[Hash()(key) % ShardCount]; }
+
+    std::array<Shard, ShardCount> _shards;
+};
+
 template <class T>
 class HashMapHolder
 {
@@ -54,11 +128,18 @@ public:
 
     static void Remove(T* o);
 
+    // lock free with respect to GetLock(), only the shard of guid is locked
     static T* Find(WOWGUID guid);
 
+    // full container for iteration, must be used with GetLock()
     static MapType& GetContainer();
 
     static std::shared_mutex* GetLock();
+
+    static uint64 GetContendedReads();
+
+private:
+    static ShardedLookupMap<WOWGUID, T*>& GetShards();
 };
 
 namespace ObjectAccessor
@@ -110,6 +191,10 @@ namespace ObjectAccessor
     void RemoveObject(Player* player);
 
     void UpdatePlayerNameMapReference(std::string oldname, Player* player);
+
+    // reads of the player guid and name indexes which had to wait for a writer
+    uint64 GetPlayerLookupContendedReads();
+    uint64 GetPlayerNameLookupContendedReads();
 }
 
 #endif
@@ -6071,6 +6071,9 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
         } while (items->NextRow());
     }
 
+    // all expired mails are handled in a single transaction instead of one round trip per statement
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+
     uint32 deletedCount = 0;
     uint32 returnedCount = 0;
     do
@@ -6111,12 +6114,12 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
                 {
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
                     stmt->SetData(0, mailedItem.item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    trans->Append(stmt);
                 }
 
                 stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_ITEM_BY_ID);
                 stmt->SetData(0, m->messageID);
-                CharacterDatabase.Execute(stmt);
+                trans->Append(stmt);
             }
             else
             {
@@ -6128,19 +6131,19 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
                 stmt->SetData(3, uint32(curTime));
                 stmt->SetData (4, uint8(MAIL_CHECK_MASK_RETURNED));
                 stmt->SetData(5, m->messageID);
-                CharacterDatabase.Execute(stmt);
+                trans->Append(stmt);
                 for (auto const& mailedItem : m->items)
                 {
                     // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
                     stmt->SetData(0, m->sender);
                     stmt->SetData(1, mailedItem.item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    trans->Append(stmt);
 
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
                     stmt->SetData(0, m->sender);
                     stmt->SetData(1, mailedItem.item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    trans->Append(stmt);
                 }
 
                 // xinef: update global data
@@ -6157,11 +6160,13 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
         stmt->SetData(0, m->messageID);
-        CharacterDatabase.Execute(stmt);
+        trans->Append(stmt);
         delete m;
         ++deletedCount;
     } while (result->NextRow());
 
+    CharacterDatabase.CommitTransaction(trans);
+
     LOG_INFO("server.loading", ">> Processed {} expired mails: {} deleted and {} returned in {} ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -33,14 +33,23 @@ void VisibleNotifier::Visit(GameObjectMapType& m)
         if (i_largeOnly != go->IsVisibilityOverridden())
             continue;
 
-        vis_guids.erase(go->GetGUID());
+        i_visited.push_back(go->GetGUID());
         i_player.UpdateVisibilityOf(go, i_data, i_visibleNow);
     }
 }
 
 void VisibleNotifier::SendToSelf()
 {
-    // at this moment i_clientGUIDs have guids that not iterate at grid level checks
+    // Objects at the client that were not visited. Objects that appeared or disappeared during the visit
+    // were all visited, so diffing the current client set gives the same result as a copy taken up front
+    std::sort(i_visited.begin(), i_visited.end());
+
+    std::vector<WOWGUID> notVisited;
+    for (WOWGUID const& guid : i_player.m_clientGUIDs)
+        if (!std::binary_search(i_visited.begin(), i_visited.end(), guid))
+            notVisited.push_back(guid);
+
+    // at this moment notVisited has guids that not iterate at grid level checks
     // but exist one case when this possible and object not out of range: transports
     if (Transport* transport = i_player.GetTransport())
         for (Transport::PassengerSet::const_iterator itr = transport->GetPassengers().begin(); itr != transport->GetPassengers().end(); ++itr)
@@ -48,9 +57,10 @@ void VisibleNotifier::SendToSelf()
             if (i_largeOnly != (*itr)->IsVisibilityOverridden())
                 continue;
 
-            if (vis_guids.find((*itr)->GetGUID()) != vis_guids.end())
+            auto notVisitedItr = std::find(notVisited.begin(), notVisited.end(), (*itr)->GetGUID());
+            if (notVisitedItr != notVisited.end())
             {
-                vis_guids.erase((*itr)->GetGUID());
+                notVisited.erase(notVisitedItr);
 
                 switch ((*itr)->GetTypeId())
                 {
@@ -70,7 +80,7 @@ void VisibleNotifier::SendToSelf()
             }
         }
 
-    for (GuidUnorderedSet::const_iterator it = vis_guids.begin(); it != vis_guids.end(); ++it)
+    for (std::vector<WOWGUID>::const_iterator it = notVisited.begin(); it != notVisited.end(); ++it)
     {
         if (WorldObject* obj = ObjectAccessor::GetWorldObject(i_player, *it))
         {
@@ -84,7 +94,7 @@ void VisibleNotifier::SendToSelf()
                 if (i_player.CanSeeOrDetect(staticTrans, false, true))
                     continue;
 
-        i_player.m_clientGUIDs.erase(*it);
+        i_player.RemoveClientGUID(*it);
         i_data.AddOutOfRangeGUID(*it);
 
         if ((*it).IsPlayer())
@@ -171,7 +181,7 @@ void PlayerRelocationNotifier::Visit(PlayerMapType& m)
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
         Player* player = iter->GetSource();
-        vis_guids.erase(player->GetGUID());
+        i_visited.push_back(player->GetGUID());
         i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
         player->UpdateVisibilityOf(&i_player); // this notifier with different Visit(PlayerMapType&) than VisibleNotifier is needed to update visibility of self for other players when we move (eg. stealth detection changes)
     }
@@ -209,6 +219,28 @@ void AIRelocationNotifier::Visit(CreatureMapType& m)
     }
 }
 
+void AIRelocationBatchNotifier::Visit(CreatureMapType& m)
+{
+    for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        Creature* c = iter->GetSource();
+
+        // a creature of the batch still has NOTIFY_AI_RELOCATION set here, its own pass below already covers other creatures
+        bool batched = i_batch.find(c) != i_batch.end();
+
+        for (Unit* unit : i_units)
+        {
+            bool isCreature = unit->GetTypeId() == TYPEID_UNIT;
+
+            if ((batched ? !isCreature : !c->isNeedNotify(NOTIFY_VISIBILITY_CHANGED | NOTIFY_AI_RELOCATION)) && !c->IsMoveInLineOfSightStrictlyDisabled())
+                CreatureUnitRelocationWorker(c, unit);
+
+            if (isCreature && !unit->ToCreature()->IsMoveInLineOfSightStrictlyDisabled())
+                CreatureUnitRelocationWorker(unit->ToCreature(), c);
+        }
+    }
+}
+
 void MessageDistDeliverer::Visit(PlayerMapType& m)
 {
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
@@ -293,6 +325,28 @@ void MessageDistDeliverer::Visit(DynamicObjectMapType& m)
     }
 }
 
+void MessageDistDeliverer::VisitObserver(Player* observer)
+{
+    // Players sharing the vision of a unit or far sight dynamic object receive what happens around their seer
+    WorldObject const* target = observer;
+    if (observer->m_seer != observer && !observer->GetVehicle())
+        target = observer->m_seer;
+
+    if (!target || !target->IsInWorld() || target->GetMap() != i_source->GetMap() || !target->InSamePhase(i_phaseMask))
+        return;
+
+    if (required3dDist)
+    {
+        if (target->GetExactDistSq(i_source) > i_distSq)
+            return;
+    }
+    else
+        if (target->GetExactDist2dSq(i_source) > i_distSq)
+            return;
+
+    SendPacket(observer);
+}
+
 void MessageDistDelivererToHostile::Visit(PlayerMapType& m)
 {
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
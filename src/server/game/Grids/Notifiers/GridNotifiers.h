@@ -43,15 +43,17 @@ namespace Acore
     struct VisibleNotifier
     {
         Player& i_player;
-        GuidUnorderedSet vis_guids;
+        // objects checked during the visit, whatever else is at the client went out of range
+        std::vector<WOWGUID> i_visited;
         std::vector<Unit*>& i_visibleNow;
         bool i_gobjOnly;
         bool i_largeOnly;
         UpdateData i_data;
 
         VisibleNotifier(Player& player, bool gobjOnly, bool largeOnly) :
-            i_player(player), vis_guids(player.m_clientGUIDs), i_visibleNow(player.m_newVisible), i_gobjOnly(gobjOnly), i_largeOnly(largeOnly)
+            i_player(player), i_visibleNow(player.m_newVisible), i_gobjOnly(gobjOnly), i_largeOnly(largeOnly)
         {
+            i_visited.reserve(player.m_clientGUIDs.size());
             i_visibleNow.clear();
         }
 
@@ -96,6 +98,16 @@ namespace Acore
         void Visit(CreatureMapType&);
     };
 
+    // AIRelocationNotifier for all units of a map update reaching the visited cell, see Map::HandleDelayedAINotify()
+    struct AIRelocationBatchNotifier
+    {
+        std::unordered_set<Unit*> const& i_batch;
+        std::vector<Unit*> i_units;
+        explicit AIRelocationBatchNotifier(std::unordered_set<Unit*> const& batch) : i_batch(batch) {}
+        template<class T> void Visit(GridRefMgr<T>&) {}
+        void Visit(CreatureMapType&);
+    };
+
     struct MessageDistDeliverer
     {
         WorldObject const* i_source;
@@ -115,6 +127,8 @@ namespace Acore
         void Visit(CreatureMapType& m);
         void Visit(DynamicObjectMapType& m);
         template<class SKIP> void Visit(GridRefMgr<SKIP>&) {}
+        // Same range and phase checks as the grid visit, for a player that has the source at its client
+        void VisitObserver(Player* observer);
 
         void SendPacket(Player* player)
         {
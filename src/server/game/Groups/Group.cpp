@@ -1737,20 +1737,29 @@ void Group::SendUpdateToPlayer(WOWGUID playerGUID, MemberSlot* slot)
     player->User()->Send(&data);
 }
 
-void Group::UpdatePlayerOutOfRange(Player* player)
+uint32 Group::UpdatePlayerOutOfRange(Player* player)
 {
     if (!player || !player->IsInWorld())
-        return;
+        return 0;
 
     WDataStore data;
-    player->User()->BuildPartyMemberStatsChangedPacket(player, &data);
+    uint32 sentPackets = 0;
 
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
     {
         Player* member = itr->GetSource();
         if (member && (!member->IsInMap(player) || !member->IsWithinDist(player, member->GetSightRange(player), false)))
+        {
+            // members in range get the changes through object updates, most of the time nobody needs the packet
+            if (!sentPackets)
+                player->User()->BuildPartyMemberStatsChangedPacket(player, &data);
+
             member->User()->Send(&data);
+            ++sentPackets;
+        }
     }
+
+    return sentPackets;
 }
 
 void Group::BroadcastPacket(WDataStore const* packet, bool ignorePlayersInBGRaid, int group, WOWGUID ignore)
@@ -273,7 +273,8 @@ public:
     void SendTargetIconList(User* session);
     void SendUpdate();
     void SendUpdateToPlayer(WOWGUID playerGUID, MemberSlot* slot = nullptr);
-    void UpdatePlayerOutOfRange(Player* player);
+    // returns the number of members the stats update was sent to
+    uint32 UpdatePlayerOutOfRange(Player* player);
     // ignore: GUID of player that will be ignored
     void BroadcastPacket(WDataStore const* packet, bool ignorePlayersInBGRaid, int group = -1, WOWGUID ignore = WOWGUID::Empty);
     void BroadcastReadyCheck(WDataStore const* packet);
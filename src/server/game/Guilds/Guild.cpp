@@ -32,6 +32,7 @@
 #include "Opcodes.h"
 #include "Player.h"
 #include "ScriptMgr.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "User.h"
 #include <boost/iterator/counting_iterator.hpp>
@@ -133,29 +134,53 @@ void Guild::SendSaveEmblemResult(User* session, GuildEmblemError errCode)
 // LogHolder
 template <typename Entry>
 Guild::LogHolder<Entry>::LogHolder()
-        : m_maxRecords(sWorld->getIntConfig(std::is_same_v<Entry, BankEventLogEntry> ? CONFIG_GUILD_BANK_EVENT_LOG_COUNT : CONFIG_GUILD_EVENT_LOG_COUNT)), m_nextGUID(uint32(GUILD_EVENT_LOG_GUID_UNDEFINED))
-{ }
+        : m_first(0), m_maxRecords(sWorld->getIntConfig(std::is_same_v<Entry, BankEventLogEntry> ? CONFIG_GUILD_BANK_EVENT_LOG_COUNT : CONFIG_GUILD_EVENT_LOG_COUNT)), m_nextGUID(uint32(GUILD_EVENT_LOG_GUID_UNDEFINED))
+{
+    m_log.reserve(m_maxRecords);
+}
 
 template <typename Entry> template <typename... Ts>
 void Guild::LogHolder<Entry>::LoadEvent(Ts&&... args)
 {
-    Entry const& newEntry = m_log.emplace_front(std::forward<Ts>(args)...);
+    Entry const& newEntry = m_log.emplace_back(std::forward<Ts>(args)...);
     if (m_nextGUID == uint32(GUILD_EVENT_LOG_GUID_UNDEFINED))
         m_nextGUID = newEntry.GetGUID();
 }
 
 template <typename Entry> template <typename... Ts>
-void Guild::LogHolder<Entry>::AddEvent(CharacterDatabaseTransaction trans, Ts&&... args)
+bool Guild::LogHolder<Entry>::AddEvent(CharacterDatabaseTransaction trans, Ts&&... args)
 {
-    // Check max records limit
-    if (!CanInsert())
+    if (!m_maxRecords)
+        return false;
+
+    Entry const* entry = nullptr;
+    if (CanInsert())
+        entry = &m_log.emplace_back(std::forward<Ts>(args)...);
+    else
     {
-        m_log.pop_front();
+        // Max records limit reached, overwrite the oldest entry
+        m_log[m_first] = Entry(std::forward<Ts>(args)...);
+        entry = &m_log[m_first];
+        m_first = (m_first + 1) % m_log.size();
     }
-    // Add event to list
-    Entry const& entry = m_log.emplace_back(std::forward<Ts>(args)...);
-    // Save to DB
-    entry.SaveToDB(trans);
+
+    if (trans)
+    {
+        entry->SaveToDB(trans);
+        return false;
+    }
+
+    m_pendingSaves.insert_or_assign(entry->GetGUID(), *entry);
+    return true;
+}
+
+template <typename Entry>
+void Guild::LogHolder<Entry>::SavePendingToDB(CharacterDatabaseTransaction trans)
+{
+    for (auto const& [guid, entry] : m_pendingSaves)
+        entry.SaveToDB(trans);
+
+    m_pendingSaves.clear();
 }
 
 template <typename Entry>
@@ -1192,6 +1217,8 @@ bool Guild::SetName(std::string_view const& name)
     }
 
     m_name = name;
+    sWhoListCacheMgr->UpdateGuildName(GetId(), m_name);
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_NAME);
     stmt->SetData(0, m_name);
     stmt->SetData(1, GetId());
@@ -1776,13 +1803,10 @@ void Guild::SendInfo(User* session) const
 
 void Guild::SendEventLog(User* session) const
 {
-    std::list<EventLogEntry> const& eventLog = m_eventLog.GetGuildLog();
-
     WorldPackets::Guild::GuildEventLogQueryResults packet;
-    packet.Entry.reserve(eventLog.size());
+    packet.Entry.reserve(m_eventLog.GetSize());
 
-    for (EventLogEntry const& entry : eventLog)
-        entry.WritePacket(packet);
+    m_eventLog.ForEach([&packet](EventLogEntry const& entry) { entry.WritePacket(packet); });
 
     session->Send(packet.Write());
     LOG_DEBUG("guild", "MSG_GUILD_EVENT_LOG_QUERY [{}]", session->GetPlayerInfo());
@@ -1793,20 +1817,26 @@ void Guild::SendBankLog(User* session, uint8 tabId) const
     // GUILD_BANK_MAX_TABS send by client for money log
     if (tabId < _GetPurchasedTabsSize() || tabId == GUILD_BANK_MAX_TABS)
     {
-        std::list<BankEventLogEntry> const& bankEventLog = m_bankEventLog[tabId].GetGuildLog();
+        LogHolder<BankEventLogEntry> const& bankEventLog = m_bankEventLog[tabId];
 
         WorldPackets::Guild::GuildBankLogQueryResults packet;
         packet.Tab = tabId;
 
-        packet.Entry.reserve(bankEventLog.size());
-        for (BankEventLogEntry const& entry : bankEventLog)
-            entry.WritePacket(packet);
+        packet.Entry.reserve(bankEventLog.GetSize());
+        bankEventLog.ForEach([&packet](BankEventLogEntry const& entry) { entry.WritePacket(packet); });
 
         session->Send(packet.Write());
         LOG_DEBUG("guild", "MSG_GUILD_BANK_LOG_QUERY [{}]", session->GetPlayerInfo());
     }
 }
 
+void Guild::SavePendingLogsToDB(CharacterDatabaseTransaction trans)
+{
+    m_eventLog.SavePendingToDB(trans);
+    for (LogHolder<BankEventLogEntry>& bankLog : m_bankEventLog)
+        bankLog.SavePendingToDB(trans);
+}
+
 void Guild::SendBankTabData(User* session, uint8 tabId, bool sendAllSlots) const
 {
     if (tabId < _GetPurchasedTabsSize())
@@ -2040,6 +2070,10 @@ bool Guild::LoadBankItemFromDB(Field* fields)
 // Validates guild data loaded from database. Returns false if guild should be deleted.
 bool Guild::Validate()
 {
+    m_eventLog.LoadFinished();
+    for (LogHolder<BankEventLogEntry>& bankLog : m_bankEventLog)
+        bankLog.LoadFinished();
+
     // Validate ranks data
     // GUILD RANKS represent a sequence starting from 0 = GUILD_MASTER (ALL PRIVILEGES) to max 9 (lowest privileges).
     // The lower rank id is considered higher rank - so promotion does rank-- and demotion does rank++
@@ -2605,9 +2639,18 @@ inline bool Guild::_MemberHasTabRights(WOWGUID guid, uint8 tabId, uint32 rights)
 // Add new event log record
 inline void Guild::_LogEvent(GuildEventLogTypes eventType, WOWGUID playerGuid1, WOWGUID playerGuid2, uint8 newRank)
 {
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
-    m_eventLog.AddEvent(trans, m_id, m_eventLog.GetNextGUID(), eventType, playerGuid1, playerGuid2, newRank);
-    CharacterDatabase.CommitTransaction(trans);
+    // With a journal interval the entry is saved by GuildMgr together with the other queued log entries
+    if (sWorld->getIntConfig(CONFIG_GUILD_LOG_SAVE_INTERVAL))
+    {
+        if (m_eventLog.AddEvent(nullptr, m_id, m_eventLog.GetNextGUID(), eventType, playerGuid1, playerGuid2, newRank))
+            sGuildMgr->ScheduleLogSave(m_id);
+    }
+    else
+    {
+        CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+        m_eventLog.AddEvent(trans, m_id, m_eventLog.GetNextGUID(), eventType, playerGuid1, playerGuid2, newRank);
+        CharacterDatabase.CommitTransaction(trans);
+    }
 
     sScriptMgr->OnGuildEvent(this, uint8(eventType), playerGuid1.GetCounter(), playerGuid2.GetCounter(), newRank);
 }
@@ -2628,8 +2671,10 @@ void Guild::_LogBankEvent(CharacterDatabaseTransaction trans, GuildBankEventLogT
         tabId = GUILD_BANK_MAX_TABS;
         dbTabId = GUILD_BANK_MONEY_LOGS_TAB;
     }
+    // Bank contents and money stay in the caller's transaction, only the log entry may be left to the journal
     LogHolder<BankEventLogEntry>& pLog = m_bankEventLog[tabId];
-    pLog.AddEvent(trans, m_id, pLog.GetNextGUID(), eventType, dbTabId, guid, itemOrMoney, itemStackCount, destTabId);
+    if (pLog.AddEvent(sWorld->getIntConfig(CONFIG_GUILD_LOG_SAVE_INTERVAL) ? nullptr : trans, m_id, pLog.GetNextGUID(), eventType, dbTabId, guid, itemOrMoney, itemStackCount, destTabId))
+        sGuildMgr->ScheduleLogSave(m_id);
 
     sScriptMgr->OnGuildBankEvent(this, uint8(eventType), tabId, guid.GetCounter(), itemOrMoney, itemStackCount, destTabId);
 }
@@ -24,6 +24,7 @@
 #include "Player.h"
 #include "World.h"
 #include "WDataStore.h"
+#include <algorithm>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -482,6 +483,7 @@ private:
     };
 
     // Class encapsulating work with events collection
+    // Entries live in a ring buffer of the configured capacity, the oldest entry is overwritten once it is full
     template <typename Entry>
     class LogHolder
     {
@@ -491,19 +493,34 @@ private:
         uint32 GetGuildId() const { return m_guildId; }
         // Checks if new log entry can be added to holder
         bool CanInsert() const { return m_log.size() < m_maxRecords; }
-        // Adds event from DB to collection
+        // Adds event from DB to collection, events are loaded newest first
         template <typename... Ts>
         void LoadEvent(Ts&&... args);
-        // Adds new event to collection and saves it to DB
+        // Puts the loaded events back in chronological order
+        void LoadFinished() { std::reverse(m_log.begin(), m_log.end()); }
+        // Adds new event to collection and saves it in trans, or queues it for SavePendingToDB() when trans is null
+        // Returns true if the event was queued
         template <typename... Ts>
-        void AddEvent(CharacterDatabaseTransaction trans, Ts&&... args);
+        bool AddEvent(CharacterDatabaseTransaction trans, Ts&&... args);
         uint32 GetNextGUID();
-        std::list<Entry>& GetGuildLog() { return m_log; }
-        std::list<Entry> const& GetGuildLog() const { return m_log; }
+        // Calls func for every entry, oldest first
+        template <typename Func>
+        void ForEach(Func&& func) const
+        {
+            for (std::size_t i = 0; i < m_log.size(); ++i)
+                func(m_log[(m_first + i) % m_log.size()]);
+        }
+        std::size_t GetSize() const { return m_log.size(); }
+
+        bool HasPendingSaves() const { return !m_pendingSaves.empty(); }
+        void SavePendingToDB(CharacterDatabaseTransaction trans);
 
     private:
         uint32 m_guildId;
-        std::list<Entry> m_log;
+        std::vector<Entry> m_log;
+        std::size_t m_first;                                // oldest entry once the buffer is full
+        // Entries waiting for the next journal save, keyed by their DB slot so a slot reused in between is written once
+        std::unordered_map<uint32, Entry> m_pendingSaves;
         uint32 const m_maxRecords;
         uint32 m_nextGUID;
     };
@@ -777,6 +794,9 @@ public:
     // Bank tabs
     void SetBankTabText(uint8 tabId, std::string_view text);
 
+    // Writes the event and bank log entries queued since the last call
+    void SavePendingLogsToDB(CharacterDatabaseTransaction trans);
+
     void ResetTimes();
 
     [[nodiscard]] bool ModifyBankMoney(CharacterDatabaseTransaction trans, const uint64& amount, bool add) { return _ModifyBankMoney(trans, amount, add); }
@@ -798,7 +818,6 @@ protected:
     std::unordered_map<uint32, Member> m_members;
     std::vector<BankTab> m_bankTabs;
 
-    // These are actually ordered lists. The first element is the oldest entry.
     LogHolder<EventLogEntry> m_eventLog;
     std::array<LogHolder<BankEventLogEntry>, GUILD_BANK_MAX_TABS + 1> m_bankEventLog = {};
 
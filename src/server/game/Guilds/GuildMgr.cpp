@@ -17,8 +17,9 @@
 
 #include "GuildMgr.h"
 #include "Common.h"
+#include "Metric.h"
 
-GuildMgr::GuildMgr() : NextGuildId(1)
+GuildMgr::GuildMgr() : NextGuildId(1), LogSaveTimer(0)
 { }
 
 GuildMgr::~GuildMgr()
@@ -412,3 +413,47 @@ void GuildMgr::ResetTimes()
 
     CharacterDatabase.DirectExecute("TRUNCATE guild_member_withdraw");
 }
+
+void GuildMgr::ScheduleLogSave(uint32 guildId)
+{
+    std::lock_guard<std::mutex> guard(PendingLogSavesLock);
+    PendingLogSaves.insert(guildId);
+}
+
+void GuildMgr::Update(uint32 diff)
+{
+    {
+        std::lock_guard<std::mutex> guard(PendingLogSavesLock);
+        if (PendingLogSaves.empty())
+            return;
+    }
+
+    LogSaveTimer += diff;
+    if (LogSaveTimer < sWorld->getIntConfig(CONFIG_GUILD_LOG_SAVE_INTERVAL))
+        return;
+
+    SavePendingLogs();
+}
+
+void GuildMgr::SavePendingLogs()
+{
+    LogSaveTimer = 0;
+
+    std::unordered_set<uint32> pendingLogSaves;
+    {
+        std::lock_guard<std::mutex> guard(PendingLogSavesLock);
+        pendingLogSaves.swap(PendingLogSaves);
+    }
+
+    if (pendingLogSaves.empty())
+        return;
+
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    for (uint32 guildId : pendingLogSaves)
+        if (Guild* guild = GetGuildById(guildId)) // disbanded guilds drop their queued entries
+            guild->SavePendingLogsToDB(trans);
+
+    METRIC_VALUE("guild_log_journal_guilds", uint64(pendingLogSaves.size()));
+
+    CharacterDatabase.CommitTransaction(trans);
+}
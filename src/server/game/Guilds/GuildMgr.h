@@ -19,6 +19,7 @@
 #define _GUILDMGR_H
 
 #include "Guild.h"
+#include <mutex>
 
 class GuildMgr
 {
@@ -42,10 +43,19 @@ public:
     void SetNextGuildId(uint32 Id) { NextGuildId = Id; }
 
     void ResetTimes();
+
+    // Guild log journal: queued event and bank log entries are written in one transaction every Guild.LogSaveInterval
+    void Update(uint32 diff);
+    void ScheduleLogSave(uint32 guildId);                   // thread safe, guild bank repairs log from map threads
+    void SavePendingLogs();
 protected:
     typedef std::unordered_map<uint32, Guild*> GuildContainer;
     uint32 NextGuildId;
     GuildContainer GuildStore;
+
+    std::mutex PendingLogSavesLock;
+    std::unordered_set<uint32> PendingLogSaves;
+    uint32 LogSaveTimer;
 };
 
 #define sGuildMgr GuildMgr::instance()
@@ -53,6 +53,7 @@
 #include "Tokenize.h"
 #include "Transport.h"
 #include "Util.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WDataStore.h"
 #include "User.h"
@@ -127,7 +128,8 @@ bool LoginQueryHolder::Initialize()
     stmt->SetData(1, uint32(GameTime::GetGameTime().count()));
     res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAILS, stmt);
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
+    // only which items each mail holds, the item bodies are loaded when the mailbox is first listed
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAIL_ITEM_HEADERS);
     stmt->SetData(0, lowGuid);
     res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS, stmt);
 
@@ -259,6 +261,7 @@ void User::HandleCharEnumOpcode(WDataStore& /*recvData*/)
     stmt->SetData(0, PET_SAVE_AS_CURRENT);
     stmt->SetData(1, GetAccountId());
 
+    // stays in the normal lane, it must not overtake a pending character delete or logout save
     _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&User::HandleCharEnum, this, std::placeholders::_1)));
 }
 
@@ -1106,6 +1109,8 @@ void User::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
         }
     }
 
+    sWhoListCacheMgr->AddPlayer(pCurrChar);
+
     sScriptMgr->OnPlayerLogin(pCurrChar);
 
     if (pCurrChar->HasAtLoginFlag(AT_LOGIN_FIRST))
@@ -1165,7 +1170,7 @@ void User::HandlePlayerLoginToCharInWorld(Player* pCurrChar)
     pCurrChar->GetMap()->SendInitTransports(pCurrChar);
     pCurrChar->GetMap()->SendInitSelf(pCurrChar);
     pCurrChar->GetMap()->SendZoneDynamicInfo(pCurrChar);
-    pCurrChar->m_clientGUIDs.clear();
+    pCurrChar->ClearClientGUIDs();
     pCurrChar->UpdateObjectVisibility(false);
 
     pCurrChar->CleanupChannels();
@@ -1103,7 +1103,7 @@ void User::SendListInventory(WOWGUID vendorGuid, uint32 vendorEntry)
                     continue;
                 }
 
-                ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(vendor->GetEntry(), item->item);
+                ConditionList const& conditions = sConditionMgr->GetConditionsForNpcVendorEvent(vendor->GetEntry(), item->item);
                 if (!sConditionMgr->IsObjectMeetToConditions(m_player, vendor, conditions))
                 {
                     LOG_DEBUG("network", "SendListInventory: conditions not met for creature entry {} item {}", vendor->GetEntry(), item->item);
@@ -361,8 +361,7 @@ void User::HandleMailMarkAsRead(WDataStore& recvData)
         if (player->unReadMails)
             --player->unReadMails;
         m->checked = m->checked | MAIL_CHECK_MASK_READ;
-        player->m_mailsUpdated = true;
-        m->state = MAIL_STATE_CHANGED;
+        player->SetMailState(m, MAIL_STATE_CHANGED);
     }
 }
 
@@ -390,7 +389,7 @@ void User::HandleMailDelete(WDataStore& recvData)
             return;
         }
 
-        m->state = MAIL_STATE_DELETED;
+        player->SetMailState(m, MAIL_STATE_DELETED);
 
         sCharacterCache->DecreaseCharacterMailCount(player->GetGUID());
     }
@@ -416,6 +415,13 @@ void User::HandleMailReturnToSender(WDataStore& recvData)
         return;
     }
 
+    // the attached items are not loaded before the mailbox is listed
+    if (m->HasItems() && !player->HasMailItemsLoaded())
+    {
+        player->SendMailResult(mailId, MAIL_RETURNED_TO_SENDER, MAIL_ERR_INTERNAL_ERROR);
+        return;
+    }
+
     if (m->HasItems())
     {
         for (MailItemInfoVec::iterator itr = m->items.begin(); itr != m->items.end(); ++itr)
@@ -493,7 +499,7 @@ void User::HandleMailTakeItem(WDataStore& recvData)
     Player* player = m_player;
 
     Mail* m = player->GetMail(mailId);
-    if (!m || m->state == MAIL_STATE_DELETED || m->deliver_time > GameTime::GetGameTime().count())
+    if (!m || m->state == MAIL_STATE_DELETED || m->deliver_time > GameTime::GetGameTime().count() || !player->HasMailItemsLoaded())
     {
         player->SendMailResult(mailId, MAIL_ITEM_TAKEN, MAIL_ERR_INTERNAL_ERROR);
         return;
@@ -568,8 +574,7 @@ void User::HandleMailTakeItem(WDataStore& recvData)
         }
 
         m->COD = 0;
-        m->state = MAIL_STATE_CHANGED;
-        player->m_mailsUpdated = true;
+        player->SetMailState(m, MAIL_STATE_CHANGED);
         player->RemoveMItem(it->GetGUID().GetCounter());
 
         uint32 count = it->GetCount();                      // save counts before store and possible merge with deleting
@@ -612,8 +617,7 @@ void User::HandleMailTakeMoney(WDataStore& recvData)
     }
 
     m->money = 0;
-    m->state = MAIL_STATE_CHANGED;
-    player->m_mailsUpdated = true;
+    player->SetMailState(m, MAIL_STATE_CHANGED);
 
     player->SendMailResult(mailId, MAIL_MONEY_TAKEN, MAIL_OK);
 
@@ -633,6 +637,36 @@ void User::HandleGetMailList(WDataStore& recvData)
     if (!CanOpenMailBox(mailbox))
         return;
 
+    if (m_player->HasMailItemsLoaded())
+    {
+        SendMailList();
+        return;
+    }
+
+    // first look into the mailbox since the login, load the attached items first
+    if (m_player->IsMailItemsLoading())
+        return;
+
+    m_player->SetMailItemsLoading();
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
+    stmt->SetData(0, m_player->GetGUID().GetCounter());
+
+    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt)
+        .WithPreparedCallback(std::bind(&User::HandleGetMailListCallback, this, m_player->GetGUID(), std::placeholders::_1)));
+}
+
+void User::HandleGetMailListCallback(WOWGUID playerGuid, PreparedQueryResult result)
+{
+    if (!m_player || m_player->GetGUID() != playerGuid)
+        return;
+
+    m_player->_LoadMailItems(result);
+    SendMailList();
+}
+
+void User::SendMailList()
+{
     Player* player = m_player;
 
     uint8 mailsCount = 0;
@@ -806,8 +840,7 @@ void User::HandleMailCreateTextItem(WDataStore& recvData)
     if (msg == BAG_OK)
     {
         m->checked = m->checked | MAIL_CHECK_MASK_COPIED;
-        m->state = MAIL_STATE_CHANGED;
-        player->m_mailsUpdated = true;
+        player->SetMailState(m, MAIL_STATE_CHANGED);
 
         player->StoreItem(dest, bodyItem, true);
         player->SendMailResult(mailId, MAIL_MADE_PERMANENT, MAIL_OK);
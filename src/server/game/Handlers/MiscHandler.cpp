@@ -283,8 +283,11 @@ void User::HandleWhoOpcode(WDataStore& recvData)
     data << uint32(matchCount);         // placeholder, count of players matching criteria
     data << uint32(displaycount);       // placeholder, count of players displayed
 
-    for (auto const& target : sWhoListCacheMgr->GetWhoList())
+    WhoListSnapshot whoList = sWhoListCacheMgr->GetWhoList();
+    for (WhoListPlayerInfoPtr const& targetInfo : *whoList)
     {
+        WhoListPlayerInfo const& target = *targetInfo;
+
         if (AccountMgr::IsPlayerAccount(security))
         {
             // player can see member of other team only if CONFIG_ALLOW_TWO_SIDE_WHO_LIST
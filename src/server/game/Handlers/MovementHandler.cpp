@@ -292,6 +292,9 @@ void User::HandleMoveTeleportAck(WDataStore& recvData)
 
     plMover->UpdatePosition(dest, true);
 
+    // the heartbeat still waiting for the map update carries the position before the teleport
+    plMover->GetMap()->CancelMovementHeartbeat(plMover);
+
     // xinef: teleport pets if they are not unsummoned
     if (Pet* pet = plMover->GetPet())
     {
@@ -556,7 +559,20 @@ void User::HandleMovementOpcodes(WDataStore& recvData)
 
     movementInfo.guid = mover->GetGUID();
     WriteMovementInfo(&data, &movementInfo);
-    mover->SendMessageToSet(&data, m_player);
+
+    // Heartbeats only refresh the position, the map relays the latest one of each mover once per update
+    if (sWorld->getBoolConfig(CONFIG_MOVEMENT_RELAY_COALESCING))
+    {
+        if (opcode == MSG_MOVE_HEARTBEAT)
+            mover->GetMap()->QueueMovementHeartbeat(mover, m_player, std::move(data));
+        else
+        {
+            mover->GetMap()->CancelMovementHeartbeat(mover);
+            mover->SendMessageToSet(&data, m_player);
+        }
+    }
+    else
+        mover->SendMessageToSet(&data, m_player);
 
     mover->m_movement = movementInfo;
 
@@ -688,6 +704,9 @@ void User::HandleForceSpeedChangeAck(WDataStore& recvData)
 
     sScriptMgr->AnticheatSetUnderACKmount(m_player);
 
+    // the heartbeat still waiting for the map update would be relayed after the new speed
+    m_player->GetMap()->CancelMovementHeartbeat(m_player);
+
     // skip all forced speed changes except last and unexpected
     // in run/mounted case used one ACK and it must be skipped.m_forced_speed_changes[MOVE_RUN} store both.
     if (m_player->m_forced_speed_changes[force_move_type] > 0)
@@ -779,6 +798,7 @@ void User::HandleMoveKnockBackAck(WDataStore& recvData)
     ReadMovementInfo(recvData, &movementInfo);
 
     m_player->m_mover->m_movement = movementInfo;
+    m_player->m_mover->GetMap()->CancelMovementHeartbeat(m_player->m_mover);
 
     WDataStore data(MSG_MOVE_KNOCK_BACK, 66);
     data << guid.WriteAsPacked();
@@ -988,6 +1008,7 @@ void User::HandleMoveRootAck(WDataStore& recvData)
 
     WDataStore data(MSG_MOVE_ROOT, 64);
     WriteMovementInfo(&data, &movementInfo);
+    mover->GetMap()->CancelMovementHeartbeat(mover);
     mover->SendMessageToSet(&data, m_player);
 }
 
@@ -1033,5 +1054,6 @@ void User::HandleMoveUnRootAck(WDataStore& recvData)
 
     WDataStore data(MSG_MOVE_UNROOT, 64);
     WriteMovementInfo(&data, &movementInfo);
+    mover->GetMap()->CancelMovementHeartbeat(mover);
     mover->SendMessageToSet(&data, m_player);
 }
@@ -16,6 +16,7 @@
  */
 
 #include "LootMgr.h"
+#include "AliasTable.h"
 #include "Containers.h"
 #include "DisableMgr.h"
 #include "Group.h"
@@ -105,6 +106,7 @@ public:
     float TotalChance() const;                          // Overall chance for the group
 
     void Verify(LootStore const& lootstore, uint32 id, uint8 group_id) const;
+    void BuildRollTables();
     void CollectLootIds(LootIdSet& set) const;
     void CheckLootRefs(LootTemplateMap const& store, LootIdSet* ref_set) const;
     LootStoreItemList* GetExplicitlyChancedItemList() { return &ExplicitlyChanced; }
@@ -114,6 +116,12 @@ private:
     LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
     LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
 
+    // Load time roll data, used as long as no entry can be filtered out for the loot being filled
+    Acore::AliasTable ExplicitlyChancedTable;           // One slot per explicitly chanced entry plus a trailing slot for "nothing"
+    uint16 ExplicitlyChancedLootModes = 0;              // Loot modes shared by all explicitly chanced entries
+    uint16 EqualChancedLootModes = 0;                   // Loot modes shared by all equal chanced entries
+    uint8 GroupId = 0;
+
     LootStoreItem const* Roll(Loot& loot, Player const* player, LootStore const& store, uint16 lootMode) const;   // Rolls an item from the group, returns nullptr if all miss their chances
 
     // This class must never be copied - storing pointers
@@ -211,6 +219,9 @@ uint32 LootStore::LoadLootTable()
 
     Verify();                                           // Checks validity of the loot store
 
+    for (LootTemplateMap::const_iterator itr = m_LootTemplates.begin(); itr != m_LootTemplates.end(); ++itr)
+        itr->second->BuildRollTables();
+
     return count;
 }
 
@@ -644,45 +655,49 @@ void Loot::FillNotNormalLootFor(Player* player)
         else
             item = &quest_items[i - itemsSize];
 
-        if (!item->is_looted && item->freeforall && item->AllowedForPlayer(player, sourceWorldObjectGUID))
-            if (ItemTemplate const* proto = sObjectMgr->GetItemTemplate(item->itemid))
-                if (proto->IsCurrencyToken())
-                {
-                    BAG_RESULT msg;
-                    player->StoreLootItem(i, this, msg);
-                }
+        if (item->is_looted || !item->freeforall)
+            continue;
+
+        // cheap template check first, AllowedForPlayer evaluates the loot conditions
+        ItemTemplate const* proto = sObjectMgr->GetItemTemplate(item->itemid);
+        if (proto && proto->IsCurrencyToken() && item->AllowedForPlayer(player, sourceWorldObjectGUID))
+        {
+            BAG_RESULT msg;
+            player->StoreLootItem(i, this, msg);
+        }
     }
 }
 
 QuestItemList* Loot::FillFFALoot(Player* player)
 {
-    QuestItemList* ql = new QuestItemList();
+    // the list is only allocated once the player can see something, most looters of a kill never do
+    QuestItemList* ql = nullptr;
 
     for (uint8 i = 0; i < items.size(); ++i)
     {
         LootItem& item = items[i];
         if (!item.is_looted && item.freeforall && item.AllowedForPlayer(player, containerGUID))
         {
+            if (!ql)
+                ql = new QuestItemList();
+
             ql->push_back(QuestItem(i));
             ++unlootedCount;
         }
     }
-    if (ql->empty())
-    {
-        delete ql;
-        return nullptr;
-    }
 
-    PlayerFFAItems[player->GetGUID()] = ql;
+    if (ql)
+        PlayerFFAItems[player->GetGUID()] = ql;
+
     return ql;
 }
 
 QuestItemList* Loot::FillQuestLoot(Player* player)
 {
-    if (items.size() == MAX_NR_LOOT_ITEMS)
+    if (items.size() == MAX_NR_LOOT_ITEMS || quest_items.empty())
         return nullptr;
 
-    QuestItemList* ql = new QuestItemList();
+    QuestItemList* ql = nullptr;
 
     Player* lootOwner = (roundRobinPlayer) ? ObjectAccessor::FindPlayer(roundRobinPlayer) : player;
 
@@ -705,6 +720,9 @@ QuestItemList* Loot::FillQuestLoot(Player* player)
             continue;
         }
 
+        if (!ql)
+            ql = new QuestItemList();
+
         ql->push_back(QuestItem(i));
         ++unlootedCount;
 
@@ -716,19 +734,16 @@ QuestItemList* Loot::FillQuestLoot(Player* player)
         if (items.size() + ql->size() == MAX_NR_LOOT_ITEMS)
             break;
     }
-    if (ql->empty())
-    {
-        delete ql;
-        return nullptr;
-    }
 
-    PlayerQuestItems[player->GetGUID()] = ql;
+    if (ql)
+        PlayerQuestItems[player->GetGUID()] = ql;
+
     return ql;
 }
 
 QuestItemList* Loot::FillNonQuestNonFFAConditionalLoot(Player* player)
 {
-    QuestItemList* ql = new QuestItemList();
+    QuestItemList* ql = nullptr;
 
     for (uint8 i = 0; i < items.size(); ++i)
     {
@@ -740,6 +755,9 @@ QuestItemList* Loot::FillNonQuestNonFFAConditionalLoot(Player* player)
 
             if (!item.conditions.empty())
             {
+                if (!ql)
+                    ql = new QuestItemList();
+
                 ql->push_back(QuestItem(i));
                 if (!item.is_counted)
                 {
@@ -749,13 +767,10 @@ QuestItemList* Loot::FillNonQuestNonFFAConditionalLoot(Player* player)
             }
         }
     }
-    if (ql->empty())
-    {
-        delete ql;
-        return nullptr;
-    }
 
-    PlayerNonQuestNonFFAConditionalItems[player->GetGUID()] = ql;
+    if (ql)
+        PlayerNonQuestNonFFAConditionalItems[player->GetGUID()] = ql;
+
     return ql;
 }
 
@@ -1273,44 +1288,101 @@ LootTemplate::LootGroup::~LootGroup()
 // Adds an entry to the group (at loading stage)
 void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
 {
+    GroupId = item->groupid;
+
     if (item->chance != 0)
         ExplicitlyChanced.push_back(item);
     else
         EqualChanced.push_back(item);
 }
 
+// Precomputes the roll tables of the group (at loading stage)
+void LootTemplate::LootGroup::BuildRollTables()
+{
+    ExplicitlyChancedLootModes = EqualChancedLootModes = std::numeric_limits<uint16>::max();
+    for (LootStoreItem const* item : ExplicitlyChanced)
+        ExplicitlyChancedLootModes &= item->lootmode;
+    for (LootStoreItem const* item : EqualChanced)
+        EqualChancedLootModes &= item->lootmode;
+
+    // Same outcome as walking the entries in order with a single roll in [0, 100):
+    // every entry takes its chance out of what is left, a 100% entry takes everything left
+    std::vector<double> weights;
+    weights.reserve(ExplicitlyChanced.size() + 1);
+    double left = 100.0;
+    for (LootStoreItem const* item : ExplicitlyChanced)
+    {
+        if (item->chance < 0.0f)
+        {
+            // negative chances shift the roll of the following entries, keep the plain walk for them
+            ExplicitlyChancedTable = Acore::AliasTable();
+            return;
+        }
+
+        double const weight = item->chance >= 100.0f ? left : std::min<double>(item->chance, left);
+        weights.push_back(weight);
+        left -= weight;
+    }
+
+    weights.push_back(left);
+    ExplicitlyChancedTable.Build(weights);
+}
+
 // Rolls an item from the group, returns nullptr if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, Player const* player, LootStore const& store, uint16 lootMode) const
 {
-    LootStoreItemList possibleLoot = ExplicitlyChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    // Entries of the group are only filtered out by their loot mode or by drops of the group already in the loot,
+    // item templates are checked at loading. When neither applies the load time tables give the same result.
+    bool const noGroupDrop = std::none_of(loot.items.begin(), loot.items.end(), [this](LootItem const& item) { return item.groupid == GroupId; });
 
-    if (!possibleLoot.empty())                             // First explicitly chanced entries are checked
+    if (!ExplicitlyChanced.empty())                         // First explicitly chanced entries are checked
     {
-        float roll = (float)rand_chance();
-
-        for (LootStoreItemList::const_iterator itr = possibleLoot.begin(); itr != possibleLoot.end(); ++itr)   // check each explicitly chanced entry in the template and modify its chance based on quality.
+        if (noGroupDrop && (ExplicitlyChancedLootModes & lootMode) && !ExplicitlyChancedTable.empty() && !sScriptMgr->HasItemRollHooks())
+        {
+            std::size_t const index = ExplicitlyChancedTable.Pick(rand_norm());
+            if (index < ExplicitlyChanced.size())
+                return ExplicitlyChanced[index];
+        }
+        else
         {
-            LootStoreItem* item = *itr;
-            float chance = item->chance;
+            LootStoreItemList possibleLoot = ExplicitlyChanced;
+            possibleLoot.erase(std::remove_if(possibleLoot.begin(), possibleLoot.end(), LootGroupInvalidSelector(loot, lootMode)), possibleLoot.end());
 
-            if (!sScriptMgr->OnItemRoll(player, item, chance, loot, store))
-                return nullptr;
+            if (!possibleLoot.empty())
+            {
+                float roll = (float)rand_chance();
+
+                for (LootStoreItemList::const_iterator itr = possibleLoot.begin(); itr != possibleLoot.end(); ++itr)   // check each explicitly chanced entry in the template and modify its chance based on quality.
+                {
+                    LootStoreItem* item = *itr;
+                    float chance = item->chance;
 
-            if (chance >= 100.0f)
-                return item;
+                    if (!sScriptMgr->OnItemRoll(player, item, chance, loot, store))
+                        return nullptr;
 
-            roll -= chance;
-            if (roll < 0)
-                return item;
+                    if (chance >= 100.0f)
+                        return item;
+
+                    roll -= chance;
+                    if (roll < 0)
+                        return item;
+                }
+            }
         }
     }
 
     if (!sScriptMgr->OnBeforeLootEqualChanced(player, EqualChanced, loot, store))
         return nullptr;
 
-    possibleLoot = EqualChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    if (EqualChanced.empty())
+        return nullptr;
+
+    // Every equal chanced entry has the same weight, a uniform index is all the table there is
+    if (noGroupDrop && (EqualChancedLootModes & lootMode))
+        return Acore::Containers::SelectRandomContainerElement(EqualChanced);
+
+    LootStoreItemList possibleLoot = EqualChanced;
+    possibleLoot.erase(std::remove_if(possibleLoot.begin(), possibleLoot.end(), LootGroupInvalidSelector(loot, lootMode)), possibleLoot.end());
     if (!possibleLoot.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
         return Acore::Containers::SelectRandomContainerElement(possibleLoot);
 
@@ -1861,6 +1933,13 @@ void LootTemplate::Verify(LootStore const& lootstore, uint32 id) const
     /// @todo: References validity checks
 }
 
+void LootTemplate::BuildRollTables()
+{
+    for (LootGroup* group : Groups)
+        if (group)
+            group->BuildRollTables();
+}
+
 void LootTemplate::CheckLootRefs(LootTemplateMap const& store, LootIdSet* ref_set) const
 {
     for (LootStoreItemList::const_iterator ieItr = Entries.begin(); ieItr != Entries.end(); ++ieItr)
@@ -1898,7 +1977,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
         {
             if ((*i)->itemid == uint32(cond->SourceEntry))
             {
-                (*i)->conditions.push_back(cond);
+                ConditionMgr::AddToConditionList((*i)->conditions, cond);
                 return true;
             }
         }
@@ -1919,7 +1998,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
                 {
                     if ((*i)->itemid == uint32(cond->SourceEntry))
                     {
-                        (*i)->conditions.push_back(cond);
+                        ConditionMgr::AddToConditionList((*i)->conditions, cond);
                         return true;
                     }
                 }
@@ -1932,7 +2011,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
                 {
                     if ((*i)->itemid == uint32(cond->SourceEntry))
                     {
-                        (*i)->conditions.push_back(cond);
+                        ConditionMgr::AddToConditionList((*i)->conditions, cond);
                         return true;
                     }
                 }
@@ -199,7 +199,7 @@ class LootTemplate;
 typedef std::vector<QuestItem> QuestItemList;
 typedef std::vector<LootItem> LootItemList;
 typedef std::map<WOWGUID, QuestItemList*> QuestItemMap;
-typedef std::list<LootStoreItem*> LootStoreItemList;
+typedef std::vector<LootStoreItem*> LootStoreItemList;
 typedef std::unordered_map<uint32, LootTemplate*> LootTemplateMap;
 
 typedef std::set<uint32> LootIdSet;
@@ -252,6 +252,8 @@ public:
 
     // Adds an entry to the group (at loading stage)
     void AddEntry(LootStoreItem* item);
+    // Precomputes the group roll tables once all entries are added (at loading stage)
+    void BuildRollTables();
     // Rolls for every item in the template and adds the rolled items the the loot
     void Process(Loot& loot, LootStore const& store, uint16 lootMode, Player const* player, uint8 groupId = 0, bool isTopLevel = true) const;
     void CopyConditions(ConditionList conditions);
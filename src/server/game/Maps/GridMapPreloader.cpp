@@ -0,0 +1,162 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridMapPreloader.h"
+#include "Log.h"
+#include "Map.h"
+#include "World.h"
+
+GridMapPreloader::GridMapPreloader() : _cancelationToken(false), _maxPrepared(0), _sequence(0)
+{
+}
+
+void GridMapPreloader::activate(std::size_t num_threads, std::size_t maxPrepared)
+{
+    _maxPrepared = maxPrepared;
+
+    _workerThreads.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i)
+    {
+        _workerThreads.push_back(std::thread(&GridMapPreloader::WorkerThread, this));
+    }
+}
+
+void GridMapPreloader::deactivate()
+{
+    _cancelationToken = true;
+
+    _queue.Cancel();
+
+    for (auto& thread : _workerThreads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+
+    _workerThreads.clear();
+
+    std::lock_guard<std::mutex> guard(_lock);
+    for (auto& [key, entry] : _entries)
+        delete entry.Data;
+
+    _entries.clear();
+}
+
+void GridMapPreloader::schedule(uint32 mapId, int32 gx, int32 gy)
+{
+    if (!activated())
+        return;
+
+    uint64 key = MakeKey(mapId, gx, gy);
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        if (_entries.count(key))
+            return;
+
+        // grids that were flown past are never taken, drop the oldest prepared one to make room
+        if (_entries.size() >= _maxPrepared)
+        {
+            auto oldest = _entries.end();
+            for (auto itr = _entries.begin(); itr != _entries.end(); ++itr)
+                if (itr->second.State == PRELOAD_STATE_PREPARED && (oldest == _entries.end() || itr->second.Sequence < oldest->second.Sequence))
+                    oldest = itr;
+
+            if (oldest == _entries.end())
+                return;
+
+            delete oldest->second.Data;
+            _entries.erase(oldest);
+        }
+
+        PreloadEntry& entry = _entries[key];
+        entry.Sequence = ++_sequence;
+    }
+
+    _queue.Push(key);
+}
+
+GridMap* GridMapPreloader::take(uint32 mapId, int32 gx, int32 gy)
+{
+    if (!activated())
+        return nullptr;
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    auto itr = _entries.find(MakeKey(mapId, gx, gy));
+    if (itr == _entries.end())
+        return nullptr;
+
+    // Still queued or being read, the caller loads the file itself and the worker drops its result
+    GridMap* data = itr->second.Data;
+    _entries.erase(itr);
+    return data;
+}
+
+void GridMapPreloader::WorkerThread()
+{
+    while (1)
+    {
+        uint64 key = 0;
+
+        _queue.WaitAndPop(key);
+        if (_cancelationToken)
+            return;
+
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            if (!_entries.count(key))
+                continue;
+        }
+
+        uint32 mapId = uint32(key >> 32);
+        int32 gx = int32((key >> 16) & 0xFFFF);
+        int32 gy = int32(key & 0xFFFF);
+
+        std::string fileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", sWorld->GetDataPath(), mapId, gx, gy);
+
+        GridMap* data = new GridMap();
+        if (!data->loadData(fileName.data()))
+        {
+            LOG_DEBUG("maps", "GridMapPreloader: could not preload map file {}, it will be loaded on grid creation", fileName);
+            delete data;
+            data = nullptr;
+        }
+
+        std::lock_guard<std::mutex> guard(_lock);
+
+        auto itr = _entries.find(key);
+        if (itr == _entries.end())
+        {
+            // the grid was created while the file was read
+            delete data;
+            continue;
+        }
+
+        if (!data)
+        {
+            _entries.erase(itr);
+            continue;
+        }
+
+        itr->second.State = PRELOAD_STATE_PREPARED;
+        itr->second.Data = data;
+    }
+}
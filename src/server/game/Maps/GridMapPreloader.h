@@ -0,0 +1,80 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _GRID_MAP_PRELOADER_H_INCLUDED
+#define _GRID_MAP_PRELOADER_H_INCLUDED
+
+#include "Define.h"
+#include "PCQueue.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class GridMap;
+
+/*
+ * Reads terrain (.map) files of grids that are about to be entered on background threads.
+ * Only the file I/O is done off the map thread: Map::LoadMap takes the prepared GridMap
+ * when the grid is created and still runs the script hooks, vmap and mmap loading itself.
+ */
+class GridMapPreloader
+{
+public:
+    GridMapPreloader();
+    ~GridMapPreloader() = default;
+
+    void activate(std::size_t num_threads, std::size_t maxPrepared);
+    void deactivate();
+    bool activated() const { return !_workerThreads.empty(); }
+
+    //! Queues a terrain file for loading, grids already queued or prepared are ignored
+    void schedule(uint32 mapId, int32 gx, int32 gy);
+    //! Takes ownership of a prepared terrain file, nullptr if it was not (yet) loaded
+    GridMap* take(uint32 mapId, int32 gx, int32 gy);
+
+private:
+    enum PreloadState : uint8
+    {
+        PRELOAD_STATE_QUEUED,
+        PRELOAD_STATE_PREPARED
+    };
+
+    struct PreloadEntry
+    {
+        PreloadState State = PRELOAD_STATE_QUEUED;
+        GridMap* Data = nullptr;
+        uint32 Sequence = 0;
+    };
+
+    static uint64 MakeKey(uint32 mapId, int32 gx, int32 gy) { return (uint64(mapId) << 32) | (uint32(gx) << 16) | uint32(gy); }
+
+    void WorkerThread();
+
+    ProducerConsumerQueue<uint64> _queue;
+
+    std::vector<std::thread> _workerThreads;
+    std::atomic<bool> _cancelationToken;
+
+    std::mutex _lock;
+    std::unordered_map<uint64, PreloadEntry> _entries;
+    std::size_t _maxPrepared;
+    uint32 _sequence;
+};
+
+#endif //_GRID_MAP_PRELOADER_H_INCLUDED
@@ -28,6 +28,7 @@
 #include "InstanceScript.h"
 #include "LFGMgr.h"
 #include "MapInstanced.h"
+#include "MapMgr.h"
 #include "Metric.h"
 #include "MiscPackets.h"
 #include "Object.h"
@@ -36,6 +37,7 @@
 #include "ObjectMgr.h"
 #include "Pet.h"
 #include "ScriptMgr.h"
+#include "ScriptProfiler.h"
 #include "Transport.h"
 #include "VMapFactory.h"
 #include "Vehicle.h"
@@ -205,19 +207,28 @@ void Map::LoadMap(int gx, int gy, bool reload)
         GridMaps[gx][gy] = nullptr;
     }
 
-    // map file name
-    char* tmp = nullptr;
-    int len = sWorld->GetDataPath().length() + strlen("maps/%03u%02u%02u.map") + 1;
-    tmp = new char[len];
-    snprintf(tmp, len, (char*)(sWorld->GetDataPath() + "maps/%03u%02u%02u.map").c_str(), GetId(), gx, gy);
-    LOG_DEBUG("maps", "Loading map {}", tmp);
-    // loading data
-    GridMaps[gx][gy] = new GridMap();
-    if (!GridMaps[gx][gy]->loadData(tmp))
+    // terrain file may already have been read in the background, see PreloadGridMapsAhead()
+    if (!reload)
+        GridMaps[gx][gy] = sMapMgr->GetGridMapPreloader()->take(GetId(), gx, gy);
+
+    if (!GridMaps[gx][gy])
     {
-        LOG_ERROR("maps", "Error loading map file: \n {}\n", tmp);
+        // map file name
+        char* tmp = nullptr;
+        int len = sWorld->GetDataPath().length() + strlen("maps/%03u%02u%02u.map") + 1;
+        tmp = new char[len];
+        snprintf(tmp, len, (char*)(sWorld->GetDataPath() + "maps/%03u%02u%02u.map").c_str(), GetId(), gx, gy);
+        LOG_DEBUG("maps", "Loading map {}", tmp);
+        // loading data
+        GridMaps[gx][gy] = new GridMap();
+        if (!GridMaps[gx][gy]->loadData(tmp))
+        {
+            LOG_ERROR("maps", "Error loading map file: \n {}\n", tmp);
+        }
+        delete [] tmp;
     }
-    delete [] tmp;
+    else
+        LOG_DEBUG("maps", "Using preloaded map file of map {} grid [{}, {}]", GetId(), gx, gy);
 
     sScriptMgr->OnLoadGridMap(this, GridMaps[gx][gy], gx, gy);
 }
@@ -494,6 +505,48 @@ void Map::LoadGrid(float x, float y)
     EnsureGridLoaded(Cell(x, y));
 }
 
+void Map::PreloadGridMapsAhead(Player* player)
+{
+    // Instances use the terrain of their base map
+    if (i_InstanceId != 0)
+        return;
+
+    GridMapPreloader* preloader = sMapMgr->GetGridMapPreloader();
+    if (!preloader->activated())
+        return;
+
+    bool const onSpline = !player->movespline->Finalized();
+    if (!onSpline && !player->IsMoving())
+        return;
+
+    float angle = player->GetOrientation();
+    float lookahead = player->GetSpeed(onSpline || player->IsFlying() ? MOVE_FLIGHT : MOVE_RUN) * sWorld->getIntConfig(CONFIG_GRID_PRELOAD_LOOKAHEAD);
+
+    // taxi paths and scripted movement, head towards the end of the path
+    if (onSpline)
+    {
+        G3D::Vector3 const destination = player->movespline->FinalDestination();
+        angle = player->GetAngle(destination.x, destination.y);
+        lookahead = std::min(lookahead, player->GetExactDist2d(destination.x, destination.y));
+    }
+
+    // sample every half grid so no grid crossed within the lookahead distance is skipped
+    for (float dist = SIZE_OF_GRIDS / 2; dist <= lookahead; dist += SIZE_OF_GRIDS / 2)
+    {
+        float x = player->GetPositionX() + dist * std::cos(angle);
+        float y = player->GetPositionY() + dist * std::sin(angle);
+        if (!Acore::IsValidMapCoord(x, y))
+            break;
+
+        GridCoord p = Acore::ComputeGridCoord(x, y);
+        int gx = (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord;
+        int gy = (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord;
+
+        if (!GridMaps[gx][gy])
+            preloader->schedule(GetId(), gx, gy);
+    }
+}
+
 void Map::LoadAllCells()
 {
     for (uint32 cellX = 0; cellX < TOTAL_NUMBER_OF_CELLS_PER_MAP; cellX++)
@@ -524,7 +577,7 @@ bool Map::AddPlayerToMap(Player* player)
     SendInitSelf(player);
     SendZoneDynamicInfo(player);
 
-    player->m_clientGUIDs.clear();
+    player->ClearClientGUIDs();
     player->UpdateObjectVisibility(false);
 
     if (player->IsAlive())
@@ -766,7 +819,9 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
             player->Update(s_diff);
         }
 
+        HandleDelayedAINotify();
         HandleDelayedVisibility();
+        SendQueuedMovementHeartbeats();
         return;
     }
 
@@ -816,6 +871,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
         VisitNearbyCellsOfPlayer(player, grid_object_update, world_object_update, grid_large_object_update, world_large_object_update);
 
+        PreloadGridMapsAhead(player);
+
         // If player is using far sight, visit that object too
         if (WorldObject* viewPoint = player->GetViewpoint())
         {
@@ -874,7 +931,9 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     MoveAllGameObjectsInMoveList();
     MoveAllDynamicObjectsInMoveList();
 
+    HandleDelayedAINotify();
     HandleDelayedVisibility();
+    SendQueuedMovementHeartbeats();
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
@@ -887,6 +946,74 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
 }
 
+void Map::QueueMovementHeartbeat(Unit* mover, Player* controller, WDataStore&& data)
+{
+    // a newer heartbeat of the same mover replaces the one still waiting for this update
+    MovementHeartbeatRelay& relay = _movementHeartbeats[mover->GetGUID()];
+    relay.Controller = controller->GetGUID();
+    relay.Data = std::move(data);
+    relay.Queued = true;
+    relay.LastQueuedTime = GameTime::GetGameTimeMS().count();
+}
+
+void Map::CancelMovementHeartbeat(Unit* mover)
+{
+    // state changes (start, stop, jump...) are relayed immediately and carry a newer position than the waiting heartbeat
+    auto itr = _movementHeartbeats.find(mover->GetGUID());
+    if (itr != _movementHeartbeats.end())
+        itr->second.Queued = false;
+}
+
+void Map::SendQueuedMovementHeartbeats()
+{
+    if (_movementHeartbeats.empty())
+        return;
+
+    float const farDistance = sWorld->getFloatConfig(CONFIG_MOVEMENT_RELAY_FAR_DISTANCE);
+    uint32 const farRate = std::max<uint32>(1, sWorld->getIntConfig(CONFIG_MOVEMENT_RELAY_FAR_RATE));
+    uint32 const now = GameTime::GetGameTimeMS().count();
+
+    for (auto itr = _movementHeartbeats.begin(); itr != _movementHeartbeats.end();)
+    {
+        MovementHeartbeatRelay& relay = itr->second;
+        if (!relay.Queued)
+        {
+            // keep the relay counter while the unit keeps moving
+            if (getMSTimeDiff(relay.LastQueuedTime, now) > 5 * IN_MILLISECONDS)
+                itr = _movementHeartbeats.erase(itr);
+            else
+                ++itr;
+
+            continue;
+        }
+
+        relay.Queued = false;
+
+        Player* controller = ObjectAccessor::GetPlayer(this, relay.Controller);
+        Unit* mover = controller ? ObjectAccessor::GetUnit(*controller, itr->first) : nullptr;
+        if (!mover || !mover->IsInWorld() || mover->GetMap() != this)
+        {
+            itr = _movementHeartbeats.erase(itr);
+            continue;
+        }
+
+        // observers further away than the far distance only receive every farRate-th heartbeat
+        float distance = mover->GetVisibilityRange();
+        if (relay.RelayCount++ % farRate)
+            distance = std::min(distance, farDistance);
+
+        // a player mover controlled by someone else (mind control) still receives its own movement, as SendMessageToSet does
+        if (Player* playerMover = mover->ToPlayer())
+            if (playerMover != controller)
+                playerMover->SendDirectMessage(&relay.Data);
+
+        Acore::MessageDistDeliverer notifier(mover, &relay.Data, distance, false, controller);
+        mover->SendMessageToClientObservers(notifier, distance);
+
+        ++itr;
+    }
+}
+
 void Map::HandleDelayedVisibility()
 {
     if (i_objectsForDelayedVisibility.empty())
@@ -896,6 +1023,71 @@ void Map::HandleDelayedVisibility()
     i_objectsForDelayedVisibility.clear();
 }
 
+void Map::HandleDelayedAINotify()
+{
+    if (i_objectsForDelayedAINotify.empty())
+        return;
+
+    // Units standing in the same cell mostly notify the same neighbouring cells,
+    // group them so that each of those cells is walked once for the whole group
+    std::unordered_map<uint32, std::vector<Unit*>> unitsByCell;
+    for (Unit* unit : i_objectsForDelayedAINotify)
+    {
+        if (!unit->IsInWorld() || unit->IsDuringRemoveFromWorld() || unit->FindMap() != this)
+            continue;
+
+        CellCoord standingCell = Acore::ComputeCellCoord(unit->GetPositionX(), unit->GetPositionY());
+        if (!standingCell.IsCoordValid())
+            continue;
+
+        unitsByCell[(standingCell.x_coord << 16) | standingCell.y_coord].push_back(unit);
+    }
+
+    Acore::AIRelocationBatchNotifier notifier(i_objectsForDelayedAINotify);
+    TypeContainerVisitor<Acore::AIRelocationBatchNotifier, WorldTypeMapContainer> worldNotifier(notifier);
+    TypeContainerVisitor<Acore::AIRelocationBatchNotifier, GridTypeMapContainer> gridNotifier(notifier);
+
+    std::vector<CellArea> areas;
+    for (auto& [standingCell, units] : unitsByCell)
+    {
+        areas.clear();
+        CellCoord low(TOTAL_NUMBER_OF_CELLS_PER_MAP, TOTAL_NUMBER_OF_CELLS_PER_MAP);
+        CellCoord high(0, 0);
+        for (Unit* unit : units)
+        {
+            CellArea area = Cell::CalculateCellArea(unit->GetPositionX(), unit->GetPositionY(), AI_RELOCATION_NOTIFY_DISTANCE + unit->GetCombatReach());
+            areas.push_back(area);
+            low.x_coord = std::min(low.x_coord, area.low_bound.x_coord);
+            low.y_coord = std::min(low.y_coord, area.low_bound.y_coord);
+            high.x_coord = std::max(high.x_coord, area.high_bound.x_coord);
+            high.y_coord = std::max(high.y_coord, area.high_bound.y_coord);
+        }
+
+        for (uint32 x = low.x_coord; x <= high.x_coord; ++x)
+        {
+            for (uint32 y = low.y_coord; y <= high.y_coord; ++y)
+            {
+                notifier.i_units.clear();
+                for (std::size_t i = 0; i < units.size(); ++i)
+                    if (x >= areas[i].low_bound.x_coord && x <= areas[i].high_bound.x_coord && y >= areas[i].low_bound.y_coord && y <= areas[i].high_bound.y_coord)
+                        notifier.i_units.push_back(units[i]);
+
+                if (notifier.i_units.empty())
+                    continue;
+
+                Cell cell(CellCoord(x, y));
+                cell.SetNoCreate();
+                Visit(cell, worldNotifier);
+                Visit(cell, gridNotifier);
+            }
+        }
+    }
+
+    for (Unit* unit : i_objectsForDelayedAINotify)
+        unit->RemoveFromNotify(NOTIFY_AI_RELOCATION);
+    i_objectsForDelayedAINotify.clear();
+}
+
 struct ResetNotifier
 {
     template<class T>inline void resetNotify(GridRefMgr<T>& m)
@@ -919,11 +1111,19 @@ void Map::RemovePlayerFromMap(Player* player, bool remove)
     if (!inWorld) // pussywizard: if was in world, RemoveFromWorld() called DestroyForNearbyPlayers()
         player->DestroyForNearbyPlayers(); // pussywizard: previous player->UpdateObjectVisibility(true)
 
+    // unregister from the objects of this map while they can still be found
+    player->ClearClientGUIDs();
+
     if (player->IsInGrid())
         player->RemoveFromGrid();
     else
         ASSERT(remove); //maybe deleted in logoutplayer when player is not in a map
 
+    _movementHeartbeats.erase(player->GetGUID());
+
+    if (i_objectsForDelayedAINotify.erase(player))
+        player->RemoveFromNotify(NOTIFY_AI_RELOCATION);
+
     sScriptMgr->OnPlayerLeaveMap(this, player);
     if (remove)
     {
@@ -949,6 +1149,13 @@ void Map::RemoveFromMap(T* obj, bool remove)
 
     obj->RemoveFromGrid();
 
+    // a charmed unit may still have a heartbeat of its controller waiting
+    _movementHeartbeats.erase(obj->GetGUID());
+
+    if (Unit* unit = obj->ToUnit())
+        if (i_objectsForDelayedAINotify.erase(unit))
+            unit->RemoveFromNotify(NOTIFY_AI_RELOCATION);
+
     obj->ResetMap();
 
     if (remove)
@@ -2583,15 +2790,15 @@ void Map::SendRemoveTransports(Player* player)
             (*itr)->BuildOutOfRangeUpdateBlock(&transData);
 
     // pussywizard: remove static transports from client
-    for (GuidUnorderedSet::const_iterator it = player->m_clientGUIDs.begin(); it != player->m_clientGUIDs.end(); )
+    GuidVector staticTransports;
+    for (WOWGUID const& guid : player->m_clientGUIDs)
+        if (guid.IsTransport())
+            staticTransports.push_back(guid);
+
+    for (WOWGUID const& guid : staticTransports)
     {
-        if ((*it).IsTransport())
-        {
-            transData.AddOutOfRangeGUID(*it);
-            it = player->m_clientGUIDs.erase(it);
-        }
-        else
-            ++it;
+        transData.AddOutOfRangeGUID(guid);
+        player->RemoveClientGUID(guid);
     }
 
     WDataStore packet;
@@ -3032,7 +3239,10 @@ void InstanceMap::Update(const uint32 t_diff, const uint32 s_diff, bool /*thread
 
     if (t_diff)
         if (instance_data)
+        {
+            SCRIPT_PROFILE_SCOPE(ScriptProfileCategory::InstanceScript, GetId(), GetScriptName().c_str(), "Update");
             instance_data->Update(t_diff);
+        }
 }
 
 void InstanceMap::RemovePlayerFromMap(Player* player, bool remove)
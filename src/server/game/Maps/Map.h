@@ -34,6 +34,7 @@
 #include "SharedDefines.h"
 #include "TaskScheduler.h"
 #include "Timer.h"
+#include "WDataStore.h"
 #include <bitset>
 #include <list>
 #include <memory>
@@ -372,6 +373,8 @@ public:
     }
 
     void LoadGrid(float x, float y);
+    //! Queues background reads of the terrain files on the path of a moving player
+    void PreloadGridMapsAhead(Player* player);
     void LoadAllCells();
     bool UnloadGrid(NGridType& ngrid);
     virtual void UnloadAll();
@@ -388,6 +391,13 @@ public:
     // pussywizard:
     std::unordered_set<Unit*> i_objectsForDelayedVisibility;
     void HandleDelayedVisibility();
+    std::unordered_set<Unit*> i_objectsForDelayedAINotify;
+    void HandleDelayedAINotify();
+
+    // Movement heartbeats relayed once per map update, see Movement.RelayCoalescing.Enable
+    void QueueMovementHeartbeat(Unit* mover, Player* controller, WDataStore&& data);
+    void CancelMovementHeartbeat(Unit* mover);
+    void SendQueuedMovementHeartbeats();
 
     // some calls like isInWater should not use vmaps due to processor power
     // can return INVALID_HEIGHT if under z+2 z coord not found height
@@ -678,6 +688,17 @@ private:
     std::vector<GameObject*> _gameObjectsToMove;
     std::vector<DynamicObject*> _dynamicObjectsToMove;
 
+    struct MovementHeartbeatRelay
+    {
+        WOWGUID Controller;
+        WDataStore Data;
+        bool Queued = false;
+        uint32 RelayCount = 0;
+        uint32 LastQueuedTime = 0;
+    };
+
+    std::unordered_map<WOWGUID, MovementHeartbeatRelay> _movementHeartbeats;
+
     [[nodiscard]] bool IsGridLoaded(const GridCoord&) const;
     void EnsureGridCreated_i(const GridCoord&);
 
@@ -34,6 +34,8 @@
 #include "World.h"
 #include "WDataStore.h"
 
+constexpr std::size_t MAX_PRELOADED_GRID_MAPS = 64;
+
 MapMgr::MapMgr()
 {
     i_timer[3].SetInterval(sWorld->getIntConfig(CONFIG_INTERVAL_MAPUPDATE));
@@ -58,6 +60,11 @@ void MapMgr::Initialize()
     // Start mtmaps if needed
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    // Terrain files of grids ahead of moving players are read in the background
+    int preload_threads(sWorld->getIntConfig(CONFIG_GRID_PRELOAD_THREADS));
+    if (preload_threads > 0)
+        m_gridMapPreloader.activate(preload_threads, MAX_PRELOADED_GRID_MAPS);
 }
 
 void MapMgr::InitializeVisibilityDistanceInfo()
@@ -333,6 +340,9 @@ void MapMgr::UnloadAll()
 
     if (m_updater.activated())
         m_updater.deactivate();
+
+    if (m_gridMapPreloader.activated())
+        m_gridMapPreloader.deactivate();
 }
 
 void MapMgr::GetNumInstances(uint32& dungeons, uint32& battlegrounds, uint32& arenas)
@@ -112,6 +112,40 @@ namespace Movement
                  + vertice[2] * weights[2] + vertice[3] * weights[3];
     }
 
+    // Closed form of tvec * s_catmullRomCoeffs, avoids the generic 4x4 matrix product
+    inline void CatmullRomWeights(float t, float (&w)[4])
+    {
+        float t2 = t * t;
+        float t3 = t2 * t;
+        w[0] = -0.5f * t3 + t2 - 0.5f * t;
+        w[1] = 1.5f * t3 - 2.5f * t2 + 1.f;
+        w[2] = -1.5f * t3 + 2.f * t2 + 0.5f * t;
+        w[3] = 0.5f * t3 - 0.5f * t2;
+    }
+
+    inline void CatmullRomDerivativeWeights(float t, float (&w)[4])
+    {
+        float t2 = t * t;
+        w[0] = -1.5f * t2 + 2.f * t - 0.5f;
+        w[1] = 4.5f * t2 - 5.f * t;
+        w[2] = -4.5f * t2 + 4.f * t + 0.5f;
+        w[3] = 1.5f * t2 - t;
+    }
+
+    inline void C_Evaluate_Weights(const Vector3* vertice, const float (&w)[4], Vector3& result)
+    {
+        result.x = vertice[0].x * w[0] + vertice[1].x * w[1] + vertice[2].x * w[2] + vertice[3].x * w[3];
+        result.y = vertice[0].y * w[0] + vertice[1].y * w[1] + vertice[2].y * w[2] + vertice[3].y * w[3];
+        result.z = vertice[0].z * w[0] + vertice[1].z * w[1] + vertice[2].z * w[2] + vertice[3].z * w[3];
+    }
+
+    inline void C_Evaluate_CatmullRom(const Vector3* vertice, float t, Vector3& result)
+    {
+        float w[4];
+        CatmullRomWeights(t, w);
+        C_Evaluate_Weights(vertice, w, result);
+    }
+
     void SplineBase::EvaluateLinear(index_type index, float u, Vector3& result) const
     {
         ASSERT(index >= index_lo && index < index_hi);
@@ -121,7 +155,7 @@ namespace Movement
     void SplineBase::EvaluateCatmullRom( index_type index, float t, Vector3& result) const
     {
         ASSERT(index >= index_lo && index < index_hi);
-        C_Evaluate(&points[index - 1], t, s_catmullRomCoeffs, result);
+        C_Evaluate_CatmullRom(&points[index - 1], t, result);
     }
 
     void SplineBase::EvaluateBezier3(index_type index, float t, Vector3& result) const
@@ -140,7 +174,9 @@ namespace Movement
     void SplineBase::EvaluateDerivativeCatmullRom(index_type index, float t, Vector3& result) const
     {
         ASSERT(index >= index_lo && index < index_hi);
-        C_Evaluate_Derivative(&points[index - 1], t, s_catmullRomCoeffs, result);
+        float w[4];
+        CatmullRomDerivativeWeights(t, w);
+        C_Evaluate_Weights(&points[index - 1], w, result);
     }
 
     void SplineBase::EvaluateDerivativeBezier3(index_type index, float t, Vector3& result) const
@@ -150,6 +186,36 @@ namespace Movement
         C_Evaluate_Derivative(&points[index], t, s_Bezier3Coeffs, result);
     }
 
+    void SplineBase::evaluate_percent_and_derivative(index_type index, float t, Vector3& result, Vector3& hermite) const
+    {
+        switch (m_mode)
+        {
+            case ModeLinear:
+            {
+                ASSERT(index >= index_lo && index < index_hi);
+                Vector3 const& p = points[index];
+                hermite = points[index + 1] - p;
+                result = p + hermite * t;
+                break;
+            }
+            case ModeCatmullrom:
+            {
+                ASSERT(index >= index_lo && index < index_hi);
+                Vector3 const* p = &points[index - 1];
+                float w[4];
+                CatmullRomWeights(t, w);
+                C_Evaluate_Weights(p, w, result);
+                CatmullRomDerivativeWeights(t, w);
+                C_Evaluate_Weights(p, w, hermite);
+                break;
+            }
+            default:
+                evaluate_percent(index, t, result);
+                evaluate_derivative(index, t, hermite);
+                break;
+        }
+    }
+
     float SplineBase::SegLengthLinear(index_type index) const
     {
         ASSERT(index >= index_lo && index < index_hi);
@@ -168,7 +234,7 @@ namespace Movement
         double length = 0;
         while (i <= STEPS_PER_SEGMENT)
         {
-            C_Evaluate(p, float(i) / float(STEPS_PER_SEGMENT), s_catmullRomCoeffs, nextPos);
+            C_Evaluate_CatmullRom(p, float(i) / float(STEPS_PER_SEGMENT), nextPos);
             length += (nextPos - curPos).length();
             curPos = nextPos;
             ++i;
@@ -102,6 +102,11 @@ namespace Movement
          */
         void evaluate_derivative(index_type Idx, float u, Vector3& hermite) const {(this->*derivative_evaluators[m_mode])(Idx, u, hermite);}
 
+        /** Caclulates both position and derivation in index Idx, and percent of segment length t
+            Linear and catmullrom modes share the control point loads and skip the evaluator tables.
+         */
+        void evaluate_percent_and_derivative(index_type Idx, float u, Vector3& c, Vector3& hermite) const;
+
         /**  Bounds for spline indexes. All indexes should be in range [first, last). */
         [[nodiscard]] index_type first() const { return index_lo;}
         [[nodiscard]] index_type last()  const { return index_hi;}
@@ -165,6 +170,8 @@ namespace Movement
             @param t  - percent of spline segment length, assumes that t in range [0, 1]. */
         void evaluate_derivative(index_type Idx, float u, Vector3& c) const { SplineBase::evaluate_derivative(Idx, u, c);}
 
+        void evaluate_percent_and_derivative(index_type Idx, float u, Vector3& c, Vector3& hermite) const { SplineBase::evaluate_percent_and_derivative(Idx, u, c, hermite);}
+
         // Assumes that t in range [0, 1]
         [[nodiscard]] index_type computeIndexInBounds(float t) const;
         void computeIndex(float t, index_type& out_idx, float& out_u) const;
@@ -54,9 +54,19 @@ bool ScriptMgr::OnItemRoll(Player const* player, LootStoreItem const* lootStoreI
     CALL_ENABLED_BOOLEAN_HOOKS(GlobalScript, GLOBALHOOK_ON_ITEM_ROLL, !script->OnItemRoll(player, lootStoreItem, chance, loot, store));
 }
 
-bool ScriptMgr::OnBeforeLootEqualChanced(Player const* player, LootStoreItemList equalChanced, Loot& loot, LootStore const& store)
+bool ScriptMgr::HasItemRollHooks() const
 {
-    CALL_ENABLED_BOOLEAN_HOOKS(GlobalScript, GLOBALHOOK_ON_BEFORE_LOOT_EQUAL_CHANCED, !script->OnBeforeLootEqualChanced(player, equalChanced, loot, store));
+    return !ScriptRegistry<GlobalScript>::EnabledHooks[GLOBALHOOK_ON_ITEM_ROLL].empty();
+}
+
+bool ScriptMgr::OnBeforeLootEqualChanced(Player const* player, LootStoreItemList const& equalChanced, Loot& loot, LootStore const& store)
+{
+    if (ScriptRegistry<GlobalScript>::EnabledHooks[GLOBALHOOK_ON_BEFORE_LOOT_EQUAL_CHANCED].empty())
+        return true;
+
+    // scripts keep receiving the list they were written against, only built when someone listens
+    std::list<LootStoreItem*> const equalChancedList(equalChanced.begin(), equalChanced.end());
+    CALL_ENABLED_BOOLEAN_HOOKS(GlobalScript, GLOBALHOOK_ON_BEFORE_LOOT_EQUAL_CHANCED, !script->OnBeforeLootEqualChanced(player, equalChancedList, loot, store));
 }
 
 void ScriptMgr::OnInitializeLockedDungeons(Player* player, uint8& level, uint32& lockData, lfg::LFGDungeonData const* dungeon)
@@ -160,6 +160,7 @@ public: /* ServerScript */
     void OnSocketClose(std::shared_ptr<WowConnection> socket);
     bool CanPacketReceive(User* session, WDataStore const& packet);
     bool CanPacketSend(User* session, WDataStore const& packet);
+    bool HasPacketSendHooks() const;
 
 public: /* WorldScript */
     void OnLoadCustomDatabaseTable();
@@ -514,7 +515,8 @@ public: /* GlobalScript */
     void OnAfterCalculateLootGroupAmount(Player const* player, Loot& loot, uint16 lootMode, uint32& groupAmount, LootStore const& store);
     void OnBeforeDropAddItem(Player const* player, Loot& loot, bool canRate, uint16 lootMode, LootStoreItem* LootStoreItem, LootStore const& store);
     bool OnItemRoll(Player const* player, LootStoreItem const* LootStoreItem, float& chance, Loot& loot, LootStore const& store);
-    bool OnBeforeLootEqualChanced(Player const* player, LootStoreItemList EqualChanced, Loot& loot, LootStore const& store);
+    bool HasItemRollHooks() const;
+    bool OnBeforeLootEqualChanced(Player const* player, LootStoreItemList const& EqualChanced, Loot& loot, LootStore const& store);
     void OnInitializeLockedDungeons(Player* player, uint8& level, uint32& lockData, lfg::LFGDungeonData const* dungeon);
     void OnAfterInitializeLockedDungeons(Player* player);
     void OnAfterUpdateEncounterState(Map* map, EncounterCreditType type, uint32 creditEntry, Unit* source, Difficulty difficulty_fixed, DungeonEncounterList const* encounters, uint32 dungeonCompleted, bool updated);
@@ -0,0 +1,191 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ScriptProfiler.h"
+#include "DBCStores.h"
+#include "GameTime.h"
+#include "Log.h"
+#include "ObjectMgr.h"
+#include "SpellInfo.h"
+#include "SpellMgr.h"
+#include "Timer.h"
+#include <algorithm>
+#include <fstream>
+
+namespace
+{
+    char const* GetCategoryName(ScriptProfileCategory category)
+    {
+        switch (category)
+        {
+            case ScriptProfileCategory::SpellEffect:    return "SpellEffect";
+            case ScriptProfileCategory::AuraTick:       return "AuraTick";
+            case ScriptProfileCategory::SpellScript:    return "SpellScript";
+            case ScriptProfileCategory::AuraScript:     return "AuraScript";
+            case ScriptProfileCategory::CreatureAI:     return "CreatureAI";
+            case ScriptProfileCategory::InstanceScript: return "InstanceScript";
+            default:                                    return "Unknown";
+        }
+    }
+}
+
+ScriptProfiler* ScriptProfiler::instance()
+{
+    static ScriptProfiler instance;
+    return &instance;
+}
+
+ScriptProfiler::ThreadTable& ScriptProfiler::GetThreadTable()
+{
+    // the table is shared with _tables so its samples survive the thread
+    thread_local std::shared_ptr<ThreadTable> table;
+    if (!table)
+    {
+        table = std::make_shared<ThreadTable>();
+        std::lock_guard<std::mutex> guard(_tablesLock);
+        _tables.push_back(table);
+    }
+
+    return *table;
+}
+
+void ScriptProfiler::SetDumpSettings(uint32 intervalMs, std::string const& fileName)
+{
+    _dumpInterval = intervalMs;
+    _dumpTimer = 0;
+    _dumpFileName = fileName;
+}
+
+void ScriptProfiler::Record(ScriptProfileKey const& key, uint64 elapsed)
+{
+    ThreadTable& table = GetThreadTable();
+    std::lock_guard<std::mutex> guard(table.Lock);
+    ScriptProfileStats& stats = table.Stats[key];
+    ++stats.Calls;
+    stats.TotalTime += elapsed;
+    stats.MaxTime = std::max(stats.MaxTime, elapsed);
+}
+
+void ScriptProfiler::Reset()
+{
+    std::lock_guard<std::mutex> guard(_tablesLock);
+    for (std::shared_ptr<ThreadTable> const& table : _tables)
+    {
+        std::lock_guard<std::mutex> tableGuard(table->Lock);
+        table->Stats.clear();
+    }
+}
+
+ScriptProfileReport ScriptProfiler::BuildReport(std::size_t count) const
+{
+    std::unordered_map<ScriptProfileKey, ScriptProfileStats, ScriptProfileKeyHash> merged;
+    {
+        std::lock_guard<std::mutex> guard(_tablesLock);
+        for (std::shared_ptr<ThreadTable> const& table : _tables)
+        {
+            std::lock_guard<std::mutex> tableGuard(table->Lock);
+            for (auto const& [key, stats] : table->Stats)
+            {
+                ScriptProfileStats& total = merged[key];
+                total.Calls += stats.Calls;
+                total.TotalTime += stats.TotalTime;
+                total.MaxTime = std::max(total.MaxTime, stats.MaxTime);
+            }
+        }
+    }
+
+    ScriptProfileReport report(merged.begin(), merged.end());
+    std::sort(report.begin(), report.end(), [](auto const& left, auto const& right)
+    {
+        return left.second.TotalTime > right.second.TotalTime;
+    });
+
+    if (count && report.size() > count)
+        report.resize(count);
+
+    return report;
+}
+
+std::string ScriptProfiler::GetKeyDescription(ScriptProfileKey const& key)
+{
+    std::string description = Acore::StringFormatFmt("{} {}", GetCategoryName(key.Category), key.Id);
+
+    switch (key.Category)
+    {
+        case ScriptProfileCategory::SpellEffect:
+        case ScriptProfileCategory::AuraTick:
+        case ScriptProfileCategory::SpellScript:
+        case ScriptProfileCategory::AuraScript:
+            if (SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(key.Id))
+                description += Acore::StringFormatFmt(" ({})", spellInfo->SpellName[0]);
+            break;
+        case ScriptProfileCategory::CreatureAI:
+            if (CreatureTemplate const* creatureTemplate = sObjectMgr->GetCreatureTemplate(key.Id))
+                description += Acore::StringFormatFmt(" ({}) {}", creatureTemplate->Name,
+                    creatureTemplate->ScriptID ? sObjectMgr->GetScriptName(creatureTemplate->ScriptID) : creatureTemplate->AIName);
+            break;
+        case ScriptProfileCategory::InstanceScript:
+            if (MapEntry const* mapEntry = sMapStore.LookupEntry(key.Id))
+                description += Acore::StringFormatFmt(" ({})", mapEntry->name[0]);
+            break;
+        default:
+            break;
+    }
+
+    if (key.Name && *key.Name)
+        description += Acore::StringFormatFmt(" {}", key.Name);
+
+    if (key.Hook)
+        description += Acore::StringFormatFmt("::{}", key.Hook);
+
+    return description;
+}
+
+bool ScriptProfiler::DumpToFile() const
+{
+    if (_dumpFileName.empty())
+        return false;
+
+    std::ofstream file(_dumpFileName, std::ios::out | std::ios::app);
+    if (!file)
+    {
+        LOG_ERROR("server.loading", "ScriptProfiler: Unable to open file '{}' for writing", _dumpFileName);
+        return false;
+    }
+
+    ScriptProfileReport report = BuildReport();
+    file << "=== Script profile " << Acore::Time::TimeToTimestampStr(GameTime::GetGameTime()) << ", " << report.size() << " entries ===\n";
+    file << "total_ms;calls;avg_us;max_us;entry\n";
+    for (auto const& [key, stats] : report)
+        file << Acore::StringFormatFmt("{:.3f};{};{:.1f};{:.1f};{}\n", stats.TotalTime / 1000000.0, stats.Calls,
+            stats.TotalTime / 1000.0 / stats.Calls, stats.MaxTime / 1000.0, GetKeyDescription(key));
+
+    return true;
+}
+
+void ScriptProfiler::Update(uint32 diff)
+{
+    if (!_dumpInterval || !IsEnabled())
+        return;
+
+    _dumpTimer += diff;
+    if (_dumpTimer < _dumpInterval)
+        return;
+
+    _dumpTimer = 0;
+    DumpToFile();
+}
@@ -0,0 +1,158 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SCRIPT_PROFILER_H
+#define _SCRIPT_PROFILER_H
+
+#include "Define.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum class ScriptProfileCategory : uint8
+{
+    SpellEffect,    // default effect handler of Spell::HandleEffects, id is the spell id
+    AuraTick,       // default periodic handler of AuraEffect::PeriodicTick, id is the spell id
+    SpellScript,    // SpellScript hooks, id is the spell id
+    AuraScript,     // AuraScript hooks, id is the spell id
+    CreatureAI,     // CreatureAI::UpdateAI, id is the creature entry
+    InstanceScript, // InstanceScript::Update, id is the map id
+
+    Max
+};
+
+struct ScriptProfileKey
+{
+    ScriptProfileCategory Category;
+    uint32 Id;
+    char const* Name;   // must outlive the profiler, script names owned by the script loaders or ObjectMgr
+    char const* Hook;   // string literal
+
+    bool operator==(ScriptProfileKey const& right) const
+    {
+        return Category == right.Category && Id == right.Id && Name == right.Name && Hook == right.Hook;
+    }
+};
+
+struct ScriptProfileKeyHash
+{
+    std::size_t operator()(ScriptProfileKey const& key) const
+    {
+        std::size_t hash = std::hash<uint32>()(key.Id) ^ (std::size_t(key.Category) << 24);
+        hash ^= std::hash<void const*>()(key.Name) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<void const*>()(key.Hook) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+struct ScriptProfileStats
+{
+    uint64 Calls = 0;
+    uint64 TotalTime = 0; // nanoseconds
+    uint64 MaxTime = 0;   // nanoseconds
+};
+
+typedef std::vector<std::pair<ScriptProfileKey, ScriptProfileStats>> ScriptProfileReport;
+
+/**
+ * Optional wall time accounting of spell effects, aura ticks and script hooks.
+ *
+ * Samples are recorded into a table owned by the recording thread, so map
+ * threads never contend with each other. Reports merge all thread tables.
+ * When disabled, a ScriptProfileScope costs a single relaxed atomic load.
+ */
+class AC_GAME_API ScriptProfiler
+{
+public:
+    static ScriptProfiler* instance();
+
+    [[nodiscard]] bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+    void SetEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+
+    void SetDumpSettings(uint32 intervalMs, std::string const& fileName);
+
+    void Record(ScriptProfileKey const& key, uint64 elapsed);
+    void Reset();
+
+    // merged statistics of all threads sorted by total time, limited to count entries if count is not 0
+    [[nodiscard]] ScriptProfileReport BuildReport(std::size_t count = 0) const;
+    [[nodiscard]] static std::string GetKeyDescription(ScriptProfileKey const& key);
+    bool DumpToFile() const;
+
+    // periodic dump, called from World::Update
+    void Update(uint32 diff);
+
+private:
+    ScriptProfiler() = default;
+
+    struct ThreadTable
+    {
+        std::mutex Lock;
+        std::unordered_map<ScriptProfileKey, ScriptProfileStats, ScriptProfileKeyHash> Stats;
+    };
+
+    ThreadTable& GetThreadTable();
+
+    std::atomic<bool> _enabled{false};
+
+    mutable std::mutex _tablesLock;
+    std::vector<std::shared_ptr<ThreadTable>> _tables;
+
+    uint32 _dumpInterval = 0;
+    uint32 _dumpTimer = 0;
+    std::string _dumpFileName;
+};
+
+#define sScriptProfiler ScriptProfiler::instance()
+
+class ScriptProfileScope
+{
+public:
+    ScriptProfileScope(ScriptProfileCategory category, uint32 id, char const* name, char const* hook)
+        : _active(sScriptProfiler->IsEnabled())
+    {
+        if (_active)
+        {
+            _key = { category, id, name, hook };
+            _start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScriptProfileScope()
+    {
+        if (_active)
+            sScriptProfiler->Record(_key, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count());
+    }
+
+    ScriptProfileScope(ScriptProfileScope const&) = delete;
+    ScriptProfileScope& operator=(ScriptProfileScope const&) = delete;
+
+private:
+    bool _active;
+    ScriptProfileKey _key{};
+    std::chrono::steady_clock::time_point _start;
+};
+
+#define SCRIPT_PROFILE_CONCAT_(a, b) a##b
+#define SCRIPT_PROFILE_CONCAT(a, b) SCRIPT_PROFILE_CONCAT_(a, b)
+#define SCRIPT_PROFILE_SCOPE(category, id, name, hook) ScriptProfileScope SCRIPT_PROFILE_CONCAT(_scriptProfileScope, __LINE__)(category, id, name, hook)
+
+#endif
@@ -48,6 +48,7 @@
 #include "Transport.h"
 #include "Vehicle.h"
 #include "WardenWin.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WDataStore.h"
 #include "WowConnection.h"
@@ -871,6 +872,8 @@ void User::CharacterRemoveFromGame(bool save)
             }
         }
 
+        sWhoListCacheMgr->RemovePlayer(m_player->GetGUID());
+
         //! Call script hook before deletion
         sScriptMgr->OnPlayerLogout(m_player);
 
@@ -1570,6 +1573,15 @@ void User::SetFriendNotes (WOWGUID const& guid, char const* notes) {
   FriendList()->SetFriendNotes(guid, notes);
 }
 
+void User::SetSecurity(AccountTypes security)
+{
+    _security = security;
+
+    // the who list filters and shows entries by security level
+    if (m_player)
+        sWhoListCacheMgr->UpdatePlayer(m_player);
+}
+
 void User::SetPlayer(Player* player)
 {
     m_player = player;
@@ -374,6 +374,7 @@ public:
     void SendLogoutResponse (LogoutResponse& res);
 
     void Send(WDataStore const* packet);
+    std::shared_ptr<WowConnection> const& GetConnection() const { return m_sock; }
     void SendNotification(const char* format, ...) ATTR_PRINTF(2, 3);
     void SendNotification(uint32 string_id, ...);
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
@@ -397,7 +398,7 @@ public:
     void SetCurrentVendor(uint32 vendorEntry) { m_currentVendorEntry = vendorEntry; }
 
     WOWGUID::LowType GetGuidLow() const;
-    void SetSecurity(AccountTypes security) { _security = security; }
+    void SetSecurity(AccountTypes security);
     std::string const& GetRemoteAddress() { return m_Address; }
     void SetPlayer(Player* player);
     uint8 Expansion() const { return m_expansion; }
@@ -776,6 +777,8 @@ public:                                                 // opcodes handlers
     void HandleBuyBankSlotOpcode(WorldPackets::Bank::BuyBankSlot& buyBankSlot);
 
     void HandleGetMailList(WDataStore& recvData);
+    void HandleGetMailListCallback(WOWGUID playerGuid, PreparedQueryResult result);
+    void SendMailList();
     void HandleSendMail(WDataStore& recvData);
     void HandleMailTakeMoney(WDataStore& recvData);
     void HandleMailTakeItem(WDataStore& recvData);
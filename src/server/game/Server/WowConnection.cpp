@@ -96,6 +96,13 @@ void EncryptableAndCompressiblePacket::CompressIfNeeded()
     if (!NeedsCompression())
         return;
 
+    // compression rewrites the buffer, so take a private copy of a shared payload first
+    if (_shared)
+    {
+        WDataStore::operator=(*_shared);
+        _shared.reset();
+    }
+
     uint32 pSize = size();
 
     uint32 destsize = compressBound(pSize);
@@ -129,7 +136,7 @@ void WowConnection::Start()
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_IP_INFO);
     stmt->SetData(0, ip_address);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WowConnection::CheckIpCallback, this, std::placeholders::_1)));
+    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt, SQL_PRIORITY_HIGH).WithPreparedCallback(std::bind(&WowConnection::CheckIpCallback, this, std::placeholders::_1)));
 }
 
 void WowConnection::CheckIpCallback(PreparedQueryResult result)
@@ -169,11 +176,12 @@ bool WowConnection::Update()
         do
         {
             queued->CompressIfNeeded();
-            ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+            WDataStore const& payload = queued->GetPayload();
+            ServerPktHeader header(payload.size() + 2, queued->GetOpcode());
             if (queued->NeedsEncryption())
                 _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-            currentPacketSize = queued->size() + header.getHeaderLength();
+            currentPacketSize = payload.size() + header.getHeaderLength();
 
             if (buffer.GetRemainingSpace() < currentPacketSize)
             {
@@ -184,8 +192,8 @@ bool WowConnection::Update()
             if (buffer.GetRemainingSpace() >= currentPacketSize)
             {
                 buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                if (!payload.empty())
+                    buffer.Write(payload.contents(), payload.size());
             }
             else    // Single packet larger than current buffer size
             {
@@ -197,8 +205,8 @@ bool WowConnection::Update()
                     _sendBufferSize = currentPacketSize;
 
                 buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                if (!payload.empty())
+                    buffer.Write(payload.contents(), payload.size());
             }
 
             delete queued;
@@ -517,6 +525,17 @@ void WowConnection::SendPacket(WDataStore const& packet)
     _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized()));
 }
 
+void WowConnection::SendSharedPacket(std::shared_ptr<WDataStore const> const& packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized()));
+}
+
 void WowConnection::HandleAuthSession(WDataStore & recvPacket)
 {
     std::shared_ptr<RealmConnection> authSession = std::make_shared<RealmConnection>();
@@ -540,7 +559,7 @@ void WowConnection::HandleAuthSession(WDataStore & recvPacket)
     stmt->SetData(0, int32(realm.Id.Realm));
     stmt->SetData(1, authSession->Account);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WowConnection::HandleAuthSessionCallback, this, authSession, std::placeholders::_1)));
+    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt, SQL_PRIORITY_HIGH).WithPreparedCallback(std::bind(&WowConnection::HandleAuthSessionCallback, this, authSession, std::placeholders::_1)));
 }
 
 void WowConnection::HandleAuthSessionCallback(std::shared_ptr<RealmConnection> authSession, PreparedQueryResult result)
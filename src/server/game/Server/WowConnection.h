@@ -43,15 +43,24 @@ public:
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    // references a payload shared by many connections instead of copying it
+    EncryptableAndCompressiblePacket(std::shared_ptr<WDataStore const> packet, bool encrypt) : WDataStore(packet->GetOpcode(), 0), _shared(std::move(packet)), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    WDataStore const& GetPayload() const { return _shared ? *_shared : *this; }
+
     bool NeedsEncryption() const { return _encrypt; }
 
-    bool NeedsCompression() const { return GetOpcode() == SMSG_UPDATE_OBJECT && size() > 100; }
+    bool NeedsCompression() const { return GetOpcode() == SMSG_UPDATE_OBJECT && GetPayload().size() > 100; }
 
     void CompressIfNeeded();
 
     std::atomic<EncryptableAndCompressiblePacket*> SocketQueueLink;
 
 private:
+    std::shared_ptr<WDataStore const> _shared;
     bool _encrypt;
 };
 
@@ -88,6 +97,8 @@ public:
     bool Update() override;
 
     void SendPacket(WDataStore const& packet);
+    /// queues a packet whose payload is shared with other connections, the payload must not be modified afterwards
+    void SendSharedPacket(std::shared_ptr<WDataStore const> const& packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
@@ -32,6 +32,7 @@
 #include "Player.h"
 #include "ReputationMgr.h"
 #include "ScriptMgr.h"
+#include "ScriptProfiler.h"
 #include "Spell.h"
 #include "SpellMgr.h"
 #include "Unit.h"
@@ -1105,6 +1106,9 @@ void AuraEffect::PeriodicTick(AuraApplication* aurApp, Unit* caster) const
     if (prevented)
         return;
 
+    // the AuraScript periodic hooks above are profiled on their own
+    SCRIPT_PROFILE_SCOPE(ScriptProfileCategory::AuraTick, GetId(), nullptr, "PeriodicTick");
+
     Unit* target = aurApp->GetTarget();
 
     // Update serverside orientation of tracking channeled auras on periodic update ticks
@@ -18,6 +18,7 @@
 #ifndef ACORE_SPELLAURAS_H
 #define ACORE_SPELLAURAS_H
 
+#include "PooledAllocator.h"
 #include "SpellAuraDefines.h"
 #include "Unit.h"
 
@@ -33,7 +34,7 @@ class Aura;
 class DynamicObject;
 class AuraScript;
 
-class AuraApplication
+class AuraApplication : public Acore::PooledObject
 {
     friend void Unit::_ApplyAura(AuraApplication* aurApp, uint8 effMask);
     friend void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMode);
@@ -83,7 +84,7 @@ public:
     void RemoveDisableMask(uint8 effIdx) { _disableMask &= ~(1 << effIdx); }
 };
 
-class Aura
+class Aura : public Acore::PooledObject
 {
     friend Aura* Unit::_TryStackingOrRefreshingExistingAura(SpellInfo const* newAura, uint8 effMask, Unit* caster, int32* baseAmount, Item* castItem, WOWGUID casterGUID, bool noPeriodicReset);
 public:
@@ -21,6 +21,7 @@
 #include "GridDefines.h"
 #include "ObjectMgr.h"
 #include "PathGenerator.h"
+#include "PooledAllocator.h"
 #include "SharedDefines.h"
 #include "SpellInfo.h"
 
@@ -264,6 +265,8 @@ struct TargetInfo
     int32  damage;
 };
 
+typedef std::list<TargetInfo, Acore::PooledAllocator<TargetInfo>> TargetInfoList;
+
 static const uint32 SPELL_INTERRUPT_NONPLAYER = 32747;
 
 struct TriggeredByAuraSpellData
@@ -280,7 +283,7 @@ struct TriggeredByAuraSpellData
     uint32 tickNumber;
 };
 
-class Spell
+class Spell : public Acore::PooledObject
 {
     friend void Unit::SetCurrentCastedSpell(Spell* pSpell);
     friend class SpellScript;
@@ -439,7 +442,8 @@ public:
     template<class SEARCHER> void SearchTargets(SEARCHER& searcher, uint32 containerMask, Unit* referer, Position const* pos, float radius);
 
     WorldObject* SearchNearbyTarget(float range, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList = nullptr);
-    void SearchAreaTargets(std::list<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList);
+    template<class Container>
+    void SearchAreaTargets(Container& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList);
     void SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, SpellTargetSelectionCategories selectCategory, ConditionList* condList, bool isChainHeal);
 
     SpellCastResult prepare(SpellCastTargets const* targets, AuraEffect const* triggeredByAura = nullptr);
@@ -584,7 +588,7 @@ public:
 
     // xinef: moved to public
     void LoadScripts();
-    std::list<TargetInfo>* GetUniqueTargetInfo() { return &m_UniqueTargetInfo; }
+    TargetInfoList* GetUniqueTargetInfo() { return &m_UniqueTargetInfo; }
 
     [[nodiscard]] uint32 GetTriggeredByAuraTickNumber() const { return m_triggeredByAuraSpell.tickNumber; }
 
@@ -679,7 +683,7 @@ public:
     // *****************************************
     // Spell target subsystem
     // *****************************************
-    std::list<TargetInfo> m_UniqueTargetInfo;
+    TargetInfoList m_UniqueTargetInfo;
     uint8 m_channelTargetEffectMask;                        // Mask req. alive targets
 
     struct GOTargetInfo
@@ -689,14 +693,16 @@ public:
         uint8  effectMask: 8;
         bool   processed: 1;
     };
-    std::list<GOTargetInfo> m_UniqueGOTargetInfo;
+    typedef std::list<GOTargetInfo, Acore::PooledAllocator<GOTargetInfo>> GOTargetInfoList;
+    GOTargetInfoList m_UniqueGOTargetInfo;
 
     struct ItemTargetInfo
     {
         Item*  item;
         uint8 effectMask;
     };
-    std::list<ItemTargetInfo> m_UniqueItemInfo;
+    typedef std::list<ItemTargetInfo, Acore::PooledAllocator<ItemTargetInfo>> ItemTargetInfoList;
+    ItemTargetInfoList m_UniqueItemInfo;
 
     SpellDestination m_destTargets[MAX_SPELL_EFFECTS];
 
@@ -822,6 +828,10 @@ namespace Acore
         WorldObjectSpellAreaTargetCheck(float range, Position const* position, Unit* caster,
                                         Unit* referer, SpellInfo const* spellInfo, SpellTargetCheckTypes selectionType, ConditionList* condList);
         bool operator()(WorldObject* target);
+    protected:
+        // cheap geometric part of the check, done before any angle or validity test
+        bool IsInRange(WorldObject* target) const;
+        bool CheckInRangeTarget(WorldObject* target);
     };
 
     struct WorldObjectSpellConeTargetCheck : public WorldObjectSpellAreaTargetCheck
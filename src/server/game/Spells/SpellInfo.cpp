@@ -2615,6 +2615,31 @@ void SpellInfo::_InitializeExplicitTargetMask()
     ExplicitTargetMask = targetMask;
 }
 
+void SpellInfo::_InitializeCastPlan()
+{
+    CastPlan = SpellCastPlan();
+    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+    {
+        if (!Effects[i].IsEffect())
+            continue;
+
+        CastPlan.EffectMask |= 1 << i;
+        CastPlan.ProvidedTargetMask[i] = Effects[i].GetProvidedTargetMask();
+
+        for (uint8 j = i + 1; j < MAX_SPELL_EFFECTS; ++j)
+        {
+            if (!Effects[j].IsEffect() ||
+                Effects[i].TargetA.GetTarget() != Effects[j].TargetA.GetTarget() ||
+                Effects[i].TargetB.GetTarget() != Effects[j].TargetB.GetTarget())
+                continue;
+
+            CastPlan.SharedTargetMask[i] |= 1 << j;
+            if (Effects[i].RadiusEntry == Effects[j].RadiusEntry)
+                CastPlan.SameRadiusMask[i] |= 1 << j;
+        }
+    }
+}
+
 bool SpellInfo::_IsPositiveEffect(uint8 effIndex, bool deep) const
 {
     // not found a single positive spell with this attribute
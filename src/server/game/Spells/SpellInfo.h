@@ -270,7 +270,7 @@ public:
     uint32    ItemType;
     uint32    TriggerSpell;
     flag96    SpellClassMask;
-    std::list<Condition*>* ImplicitTargetConditions;
+    std::vector<Condition*>* ImplicitTargetConditions;
 
     SpellEffectInfo() : _spellInfo(nullptr), _effIndex(0), Effect(0), ApplyAuraName(0), Amplitude(0), DieSides(0),
         RealPointsPerLevel(0), BasePoints(0), PointsPerComboPoint(0), ValueMultiplier(0), DamageMultiplier(0),
@@ -312,6 +312,15 @@ private:
     static std::array<StaticData, TOTAL_SPELL_EFFECTS> _data;
 };
 
+// Effect data which Spell would otherwise decode again on every cast, built once after the spell corrections are applied
+struct SpellCastPlan
+{
+    uint8 EffectMask = 0;                                       // effects with a valid effect type
+    std::array<uint32, MAX_SPELL_EFFECTS> ProvidedTargetMask{}; // target flags provided by TargetA and TargetB of each effect
+    std::array<uint8, MAX_SPELL_EFFECTS> SharedTargetMask{};    // later effects with the same TargetA and TargetB
+    std::array<uint8, MAX_SPELL_EFFECTS> SameRadiusMask{};      // subset of SharedTargetMask which also uses the same radius entry
+};
+
 class AC_GAME_API SpellInfo
 {
 friend class SpellMgr;
@@ -392,6 +401,7 @@ public:
     uint32 SchoolMask;
     std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> Effects;
     uint32 ExplicitTargetMask;
+    SpellCastPlan CastPlan;
     SpellChainNode const* ChainEntry;
 
     // Mine
@@ -529,6 +539,7 @@ public:
 
     // loading helpers
     void _InitializeExplicitTargetMask();
+    void _InitializeCastPlan();
     bool _IsPositiveEffect(uint8 effIndex, bool deep) const;
     bool _IsPositiveSpell() const;
     static bool _IsPositiveTarget(uint32 targetA, uint32 targetB);
@@ -3458,6 +3458,7 @@ void SpellMgr::LoadSpellInfoCustomAttributes()
         }
 
         spellInfo->_InitializeExplicitTargetMask();
+        spellInfo->_InitializeCastPlan();
 
         if (sSpellMgr->HasSpellCooldownOverride(spellInfo->Id))
         {
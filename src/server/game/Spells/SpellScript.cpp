@@ -170,6 +170,7 @@ SpellScript::CastHandler::CastHandler(SpellCastFnType _pCastHandlerScript)
 
 void SpellScript::CastHandler::Call(SpellScript* spellScript)
 {
+    ScriptProfileScope profile = spellScript->_ProfileHookCall();
     (spellScript->*pCastHandlerScript)();
 }
 
@@ -180,6 +181,7 @@ SpellScript::CheckCastHandler::CheckCastHandler(SpellCheckCastFnType checkCastHa
 
 SpellCastResult SpellScript::CheckCastHandler::Call(SpellScript* spellScript)
 {
+    ScriptProfileScope profile = spellScript->_ProfileHookCall();
     return (spellScript->*_checkCastHandlerScript)();
 }
 
@@ -201,6 +203,7 @@ bool SpellScript::EffectHandler::CheckEffect(SpellInfo const* spellInfo, uint8 e
 
 void SpellScript::EffectHandler::Call(SpellScript* spellScript, SpellEffIndex effIndex)
 {
+    ScriptProfileScope profile = spellScript->_ProfileHookCall();
     (spellScript->*pEffectHandlerScript)(effIndex);
 }
 
@@ -211,6 +214,7 @@ SpellScript::BeforeHitHandler::BeforeHitHandler(SpellBeforeHitFnType pBeforeHitH
 
 void SpellScript::BeforeHitHandler::Call(SpellScript* spellScript, SpellMissInfo missInfo)
 {
+    ScriptProfileScope profile = spellScript->_ProfileHookCall();
     (spellScript->*_pBeforeHitHandlerScript)(missInfo);
 }
 
@@ -221,6 +225,7 @@ SpellScript::HitHandler::HitHandler(SpellHitFnType _pHitHandlerScript)
 
 void SpellScript::HitHandler::Call(SpellScript* spellScript)
 {
+    ScriptProfileScope profile = spellScript->_ProfileHookCall();
     (spellScript->*pHitHandlerScript)();
 }
 
@@ -288,6 +293,7 @@ SpellScript::ObjectAreaTargetSelectHandler::ObjectAreaTargetSelectHandler(SpellO
 
 void SpellScript::ObjectAreaTargetSelectHandler::Call(SpellScript* spellScript, std::list<WorldObject*>& targets)
 {
+    ScriptProfileScope profile = spellScript->_ProfileHookCall();
     (spellScript->*pObjectAreaTargetSelectHandlerScript)(targets);
 }
 
@@ -299,6 +305,7 @@ SpellScript::ObjectTargetSelectHandler::ObjectTargetSelectHandler(SpellObjectTar
 
 void SpellScript::ObjectTargetSelectHandler::Call(SpellScript* spellScript, WorldObject*& target)
 {
+    ScriptProfileScope profile = spellScript->_ProfileHookCall();
     (spellScript->*pObjectTargetSelectHandlerScript)(target);
 }
 
@@ -310,6 +317,7 @@ SpellScript::DestinationTargetSelectHandler::DestinationTargetSelectHandler(Spel
 
 void SpellScript::DestinationTargetSelectHandler::Call(SpellScript* spellScript, SpellDestination& target)
 {
+    ScriptProfileScope profile = spellScript->_ProfileHookCall();
     (spellScript->*DestinationTargetSelectHandlerScript)(target);
 }
 
@@ -371,6 +379,33 @@ void SpellScript::_FinishScriptCall()
     m_currentScriptState = SPELL_SCRIPT_STATE_NONE;
 }
 
+char const* SpellScript::_GetCurrentHookName() const
+{
+    switch (m_currentScriptState)
+    {
+        case SPELL_SCRIPT_HOOK_EFFECT_LAUNCH:             return "OnEffectLaunch";
+        case SPELL_SCRIPT_HOOK_EFFECT_LAUNCH_TARGET:      return "OnEffectLaunchTarget";
+        case SPELL_SCRIPT_HOOK_EFFECT_HIT:                return "OnEffectHit";
+        case SPELL_SCRIPT_HOOK_EFFECT_HIT_TARGET:         return "OnEffectHitTarget";
+        case SPELL_SCRIPT_HOOK_BEFORE_HIT:                return "BeforeHit";
+        case SPELL_SCRIPT_HOOK_HIT:                       return "OnHit";
+        case SPELL_SCRIPT_HOOK_AFTER_HIT:                 return "AfterHit";
+        case SPELL_SCRIPT_HOOK_OBJECT_AREA_TARGET_SELECT: return "OnObjectAreaTargetSelect";
+        case SPELL_SCRIPT_HOOK_OBJECT_TARGET_SELECT:      return "OnObjectTargetSelect";
+        case SPELL_SCRIPT_HOOK_DESTINATION_TARGET_SELECT: return "OnDestinationTargetSelect";
+        case SPELL_SCRIPT_HOOK_CHECK_CAST:                return "OnCheckCast";
+        case SPELL_SCRIPT_HOOK_BEFORE_CAST:               return "BeforeCast";
+        case SPELL_SCRIPT_HOOK_ON_CAST:                   return "OnCast";
+        case SPELL_SCRIPT_HOOK_AFTER_CAST:                return "AfterCast";
+        default:                                          return "Unknown";
+    }
+}
+
+ScriptProfileScope SpellScript::_ProfileHookCall() const
+{
+    return ScriptProfileScope(ScriptProfileCategory::SpellScript, m_scriptSpellId, m_scriptName ? m_scriptName->c_str() : nullptr, _GetCurrentHookName());
+}
+
 bool SpellScript::IsInCheckCastHook() const
 {
     return m_currentScriptState == SPELL_SCRIPT_HOOK_CHECK_CAST;
@@ -767,6 +802,7 @@ AuraScript::CheckAreaTargetHandler::CheckAreaTargetHandler(AuraCheckAreaTargetFn
 
 bool AuraScript::CheckAreaTargetHandler::Call(AuraScript* auraScript, Unit* _target)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     return (auraScript->*pHandlerScript)(_target);
 }
 
@@ -777,6 +813,7 @@ AuraScript::AuraDispelHandler::AuraDispelHandler(AuraDispelFnType _pHandlerScrip
 
 void AuraScript::AuraDispelHandler::Call(AuraScript* auraScript, DispelInfo* _dispelInfo)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     (auraScript->*pHandlerScript)(_dispelInfo);
 }
 
@@ -803,6 +840,7 @@ AuraScript::EffectPeriodicHandler::EffectPeriodicHandler(AuraEffectPeriodicFnTyp
 
 void AuraScript::EffectPeriodicHandler::Call(AuraScript* auraScript, AuraEffect const* _aurEff)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     (auraScript->*pEffectHandlerScript)(_aurEff);
 }
 
@@ -814,6 +852,7 @@ AuraScript::EffectUpdatePeriodicHandler::EffectUpdatePeriodicHandler(AuraEffectU
 
 void AuraScript::EffectUpdatePeriodicHandler::Call(AuraScript* auraScript, AuraEffect* aurEff)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     (auraScript->*pEffectHandlerScript)(aurEff);
 }
 
@@ -825,6 +864,7 @@ AuraScript::EffectCalcAmountHandler::EffectCalcAmountHandler(AuraEffectCalcAmoun
 
 void AuraScript::EffectCalcAmountHandler::Call(AuraScript* auraScript, AuraEffect const* aurEff, int32& amount, bool& canBeRecalculated)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     (auraScript->*pEffectHandlerScript)(aurEff, amount, canBeRecalculated);
 }
 
@@ -836,6 +876,7 @@ AuraScript::EffectCalcPeriodicHandler::EffectCalcPeriodicHandler(AuraEffectCalcP
 
 void AuraScript::EffectCalcPeriodicHandler::Call(AuraScript* auraScript, AuraEffect const* aurEff, bool& isPeriodic, int32& periodicTimer)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     (auraScript->*pEffectHandlerScript)(aurEff, isPeriodic, periodicTimer);
 }
 
@@ -847,6 +888,7 @@ AuraScript::EffectCalcSpellModHandler::EffectCalcSpellModHandler(AuraEffectCalcS
 
 void AuraScript::EffectCalcSpellModHandler::Call(AuraScript* auraScript, AuraEffect const* aurEff, SpellModifier*& spellMod)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     (auraScript->*pEffectHandlerScript)(aurEff, spellMod);
 }
 
@@ -860,7 +902,10 @@ AuraScript::EffectApplyHandler::EffectApplyHandler(AuraEffectApplicationModeFnTy
 void AuraScript::EffectApplyHandler::Call(AuraScript* auraScript, AuraEffect const* _aurEff, AuraEffectHandleModes _mode)
 {
     if (_mode & mode)
+    {
+        ScriptProfileScope profile = auraScript->_ProfileHookCall();
         (auraScript->*pEffectHandlerScript)(_aurEff, _mode);
+    }
 }
 
 AuraScript::EffectAbsorbHandler::EffectAbsorbHandler(AuraEffectAbsorbFnType _pEffectHandlerScript, uint8 _effIndex)
@@ -871,6 +916,7 @@ AuraScript::EffectAbsorbHandler::EffectAbsorbHandler(AuraEffectAbsorbFnType _pEf
 
 void AuraScript::EffectAbsorbHandler::Call(AuraScript* auraScript, AuraEffect* aurEff, DamageInfo& dmgInfo, uint32& absorbAmount)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     (auraScript->*pEffectHandlerScript)(aurEff, dmgInfo, absorbAmount);
 }
 
@@ -882,6 +928,7 @@ AuraScript::EffectManaShieldHandler::EffectManaShieldHandler(AuraEffectAbsorbFnT
 
 void AuraScript::EffectManaShieldHandler::Call(AuraScript* auraScript, AuraEffect* aurEff, DamageInfo& dmgInfo, uint32& absorbAmount)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     (auraScript->*pEffectHandlerScript)(aurEff, dmgInfo, absorbAmount);
 }
 
@@ -893,6 +940,7 @@ AuraScript::EffectSplitHandler::EffectSplitHandler(AuraEffectSplitFnType _pEffec
 
 void AuraScript::EffectSplitHandler::Call(AuraScript* auraScript, AuraEffect* aurEff, DamageInfo& dmgInfo, uint32& splitAmount)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     (auraScript->*pEffectHandlerScript)(aurEff, dmgInfo, splitAmount);
 }
 
@@ -903,6 +951,7 @@ AuraScript::CheckProcHandler::CheckProcHandler(AuraCheckProcFnType handlerScript
 
 bool AuraScript::CheckProcHandler::Call(AuraScript* auraScript, ProcEventInfo& eventInfo)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     return (auraScript->*_HandlerScript)(eventInfo);
 }
 
@@ -913,6 +962,7 @@ AuraScript::AfterCheckProcHandler::AfterCheckProcHandler(AuraAfterCheckProcFnTyp
 
 bool AuraScript::AfterCheckProcHandler::Call(AuraScript* auraScript, ProcEventInfo& eventInfo, bool isTriggeredAtSpellProcEvent)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     return (auraScript->*_HandlerScript)(eventInfo, isTriggeredAtSpellProcEvent);
 }
 
@@ -923,6 +973,7 @@ AuraScript::AuraProcHandler::AuraProcHandler(AuraProcFnType handlerScript)
 
 void AuraScript::AuraProcHandler::Call(AuraScript* auraScript, ProcEventInfo& eventInfo)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     (auraScript->*_HandlerScript)(eventInfo);
 }
 
@@ -934,6 +985,7 @@ AuraScript::EffectProcHandler::EffectProcHandler(AuraEffectProcFnType effectHand
 
 void AuraScript::EffectProcHandler::Call(AuraScript* auraScript, AuraEffect const* aurEff, ProcEventInfo& eventInfo)
 {
+    ScriptProfileScope profile = auraScript->_ProfileHookCall();
     (auraScript->*_EffectHandlerScript)(aurEff, eventInfo);
 }
 
@@ -963,6 +1015,43 @@ void AuraScript::_FinishScriptCall()
     m_scriptStates.pop();
 }
 
+char const* AuraScript::_GetCurrentHookName() const
+{
+    switch (m_currentScriptState)
+    {
+        case AURA_SCRIPT_HOOK_EFFECT_APPLY:            return "OnEffectApply";
+        case AURA_SCRIPT_HOOK_EFFECT_AFTER_APPLY:      return "AfterEffectApply";
+        case AURA_SCRIPT_HOOK_EFFECT_REMOVE:           return "OnEffectRemove";
+        case AURA_SCRIPT_HOOK_EFFECT_AFTER_REMOVE:     return "AfterEffectRemove";
+        case AURA_SCRIPT_HOOK_EFFECT_PERIODIC:         return "OnEffectPeriodic";
+        case AURA_SCRIPT_HOOK_EFFECT_UPDATE_PERIODIC:  return "OnEffectUpdatePeriodic";
+        case AURA_SCRIPT_HOOK_EFFECT_CALC_AMOUNT:      return "DoEffectCalcAmount";
+        case AURA_SCRIPT_HOOK_EFFECT_CALC_PERIODIC:    return "DoEffectCalcPeriodic";
+        case AURA_SCRIPT_HOOK_EFFECT_CALC_SPELLMOD:    return "DoEffectCalcSpellMod";
+        case AURA_SCRIPT_HOOK_EFFECT_ABSORB:           return "OnEffectAbsorb";
+        case AURA_SCRIPT_HOOK_EFFECT_AFTER_ABSORB:     return "AfterEffectAbsorb";
+        case AURA_SCRIPT_HOOK_EFFECT_MANASHIELD:       return "OnEffectManaShield";
+        case AURA_SCRIPT_HOOK_EFFECT_AFTER_MANASHIELD: return "AfterEffectManaShield";
+        case AURA_SCRIPT_HOOK_EFFECT_SPLIT:            return "OnEffectSplit";
+        case AURA_SCRIPT_HOOK_CHECK_AREA_TARGET:       return "DoCheckAreaTarget";
+        case AURA_SCRIPT_HOOK_DISPEL:                  return "OnDispel";
+        case AURA_SCRIPT_HOOK_AFTER_DISPEL:            return "AfterDispel";
+        case AURA_SCRIPT_HOOK_CHECK_PROC:              return "DoCheckProc";
+        case AURA_SCRIPT_HOOK_AFTER_CHECK_PROC:        return "DoAfterCheckProc";
+        case AURA_SCRIPT_HOOK_PREPARE_PROC:            return "DoPrepareProc";
+        case AURA_SCRIPT_HOOK_PROC:                    return "OnProc";
+        case AURA_SCRIPT_HOOK_EFFECT_PROC:             return "OnEffectProc";
+        case AURA_SCRIPT_HOOK_EFFECT_AFTER_PROC:       return "AfterEffectProc";
+        case AURA_SCRIPT_HOOK_AFTER_PROC:              return "AfterProc";
+        default:                                       return "Unknown";
+    }
+}
+
+ScriptProfileScope AuraScript::_ProfileHookCall() const
+{
+    return ScriptProfileScope(ScriptProfileCategory::AuraScript, m_scriptSpellId, m_scriptName ? m_scriptName->c_str() : nullptr, _GetCurrentHookName());
+}
+
 bool AuraScript::_IsDefaultActionPrevented()
 {
     switch (m_currentScriptState)
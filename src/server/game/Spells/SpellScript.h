@@ -18,6 +18,7 @@
 #ifndef __SPELL_SCRIPT_H
 #define __SPELL_SCRIPT_H
 
+#include "ScriptProfiler.h"
 #include "SharedDefines.h"
 #include "Spell.h"
 #include "SpellAuraDefines.h"
@@ -302,6 +303,8 @@ public:
     bool _IsDefaultEffectPrevented(SpellEffIndex effIndex) { return m_hitPreventDefaultEffectMask & (1 << effIndex); }
     void _PrepareScriptCall(SpellScriptHookType hookType);
     void _FinishScriptCall();
+    char const* _GetCurrentHookName() const;
+    ScriptProfileScope _ProfileHookCall() const;
     bool IsInCheckCastHook() const;
     bool IsInTargetHook() const;
     bool IsInHitPhase() const;
@@ -691,6 +694,8 @@ public:
     bool _Load(Aura* aura);
     void _PrepareScriptCall(AuraScriptHookType hookType, AuraApplication const* aurApp = nullptr);
     void _FinishScriptCall();
+    char const* _GetCurrentHookName() const;
+    ScriptProfileScope _ProfileHookCall() const;
     bool _IsDefaultActionPrevented();
 private:
     Aura* m_aura;
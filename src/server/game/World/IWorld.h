@@ -187,6 +187,8 @@ enum WorldBoolConfigs
     CONFIG_ALLOWS_RANK_MOD_FOR_PET_HEALTH,
     CONFIG_MUNCHING_BLIZZLIKE,
     CONFIG_ENABLE_DAZE,
+    CONFIG_MOVEMENT_RELAY_COALESCING,
+    CONFIG_SCRIPT_PROFILER_ENABLE,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -205,6 +207,7 @@ enum WorldFloatConfigs
     CONFIG_ARENA_WIN_RATING_MODIFIER_2,
     CONFIG_ARENA_LOSE_RATING_MODIFIER,
     CONFIG_ARENA_MATCHMAKER_RATING_MODIFIER,
+    CONFIG_MOVEMENT_RELAY_FAR_DISTANCE,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
@@ -332,6 +335,7 @@ enum WorldIntConfigs
     CONFIG_ARENA_START_PERSONAL_RATING,
     CONFIG_ARENA_START_MATCHMAKER_RATING,
     CONFIG_ARENA_QUEUE_ANNOUNCER_DETAIL,
+    CONFIG_ARENA_SPECTATOR_PACKETS_PER_SECOND,
     CONFIG_HONOR_AFTER_DUEL,
     CONFIG_PVP_TOKEN_MAP_TYPE,
     CONFIG_PVP_TOKEN_ID,
@@ -339,6 +343,10 @@ enum WorldIntConfigs
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_PLAYER_ALLOW_COMMANDS,
     CONFIG_NUMTHREADS,
+    CONFIG_GRID_PRELOAD_THREADS,
+    CONFIG_GRID_PRELOAD_LOOKAHEAD,
+    CONFIG_MOVEMENT_RELAY_FAR_RATE,
+    CONFIG_SCRIPT_PROFILER_DUMP_INTERVAL,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_TELEPORT_TIMEOUT_NEAR, // pussywizard
@@ -347,6 +355,8 @@ enum WorldIntConfigs
     CONFIG_CLIENTCACHE_VERSION,
     CONFIG_GUILD_EVENT_LOG_COUNT,
     CONFIG_GUILD_BANK_EVENT_LOG_COUNT,
+    CONFIG_GUILD_LOG_SAVE_INTERVAL,
+    CONFIG_GROUP_MEMBER_STATS_UPDATE_INTERVAL,
     CONFIG_MIN_LEVEL_STAT_SAVE,
     CONFIG_RANDOM_BG_RESET_HOUR,
     CONFIG_CALENDAR_DELETE_OLD_EVENTS_HOUR,
@@ -409,6 +419,7 @@ enum WorldIntConfigs
     CONFIG_GUILD_BANK_TAB_COST_4,
     CONFIG_GUILD_BANK_TAB_COST_5,
     CONFIG_GM_LEVEL_CHANNEL_MODERATION,
+    CONFIG_CHANNEL_FANOUT_MIN_MEMBERS,
     CONFIG_TOGGLE_XP_COST,
     CONFIG_NPC_EVADE_IF_NOT_REACHABLE,
     CONFIG_NPC_REGEN_TIME_IF_NOT_REACHABLE_IN_RAID,
@@ -73,6 +73,7 @@
 #include "PoolMgr.h"
 #include "Realm.h"
 #include "ScriptMgr.h"
+#include "ScriptProfiler.h"
 #include "SkillDiscovery.h"
 #include "SkillExtraItems.h"
 #include "SmartAI.h"
@@ -1181,6 +1182,7 @@ void World::LoadConfigSettings(bool reload)
     _float_configs[CONFIG_ARENA_WIN_RATING_MODIFIER_2]              = sConfigMgr->GetOption<float>("Arena.ArenaWinRatingModifier2", 24.0f);
     _float_configs[CONFIG_ARENA_LOSE_RATING_MODIFIER]               = sConfigMgr->GetOption<float>("Arena.ArenaLoseRatingModifier", 24.0f);
     _float_configs[CONFIG_ARENA_MATCHMAKER_RATING_MODIFIER]         = sConfigMgr->GetOption<float>("Arena.ArenaMatchmakerRatingModifier", 24.0f);
+    _int_configs[CONFIG_ARENA_SPECTATOR_PACKETS_PER_SECOND]         = sConfigMgr->GetOption<uint32>("Arena.Spectator.PacketsPerSecond", 300);
     _bool_configs[CONFIG_ARENA_QUEUE_ANNOUNCER_ENABLE]              = sConfigMgr->GetOption<bool>("Arena.QueueAnnouncer.Enable", false);
     _bool_configs[CONFIG_ARENA_QUEUE_ANNOUNCER_PLAYERONLY]          = sConfigMgr->GetOption<bool>("Arena.QueueAnnouncer.PlayerOnly", false);
     _int_configs[CONFIG_ARENA_QUEUE_ANNOUNCER_DETAIL]               = sConfigMgr->GetOption<uint32>("Arena.QueueAnnouncer.Detail", 3);
@@ -1213,6 +1215,7 @@ void World::LoadConfigSettings(bool reload)
     _int_configs[CONFIG_GUILD_BANK_EVENT_LOG_COUNT] = sConfigMgr->GetOption<int32>("Guild.BankEventLogRecordsCount", GUILD_BANKLOG_MAX_RECORDS);
     if (_int_configs[CONFIG_GUILD_BANK_EVENT_LOG_COUNT] > GUILD_BANKLOG_MAX_RECORDS)
         _int_configs[CONFIG_GUILD_BANK_EVENT_LOG_COUNT] = GUILD_BANKLOG_MAX_RECORDS;
+    _int_configs[CONFIG_GUILD_LOG_SAVE_INTERVAL] = sConfigMgr->GetOption<int32>("Guild.LogSaveInterval", 10000);
 
     //visibility on continents
     _maxVisibleDistanceOnContinents = sConfigMgr->GetOption<float>("Visibility.Distance.Continents", DEFAULT_VISIBILITY_DISTANCE);
@@ -1273,6 +1276,7 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_ALLOW_JOIN_BG_AND_LFG] = sConfigMgr->GetOption<bool>("JoinBGAndLFG.Enable", false);
 
     _bool_configs[CONFIG_LEAVE_GROUP_ON_LOGOUT] = sConfigMgr->GetOption<bool>("LeaveGroupOnLogout.Enabled", false);
+    _int_configs[CONFIG_GROUP_MEMBER_STATS_UPDATE_INTERVAL] = sConfigMgr->GetOption<int32>("Group.MemberStatsUpdateInterval", 1000);
 
     _bool_configs[CONFIG_QUEST_POI_ENABLED] = sConfigMgr->GetOption<bool>("QuestPOI.Enabled", true);
 
@@ -1347,6 +1351,8 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_SHOW_MUTE_IN_WORLD]         = sConfigMgr->GetOption<bool>("ShowMuteInWorld", false);
     _bool_configs[CONFIG_SHOW_BAN_IN_WORLD]          = sConfigMgr->GetOption<bool>("ShowBanInWorld", false);
     _int_configs[CONFIG_NUMTHREADS]                  = sConfigMgr->GetOption<int32>("MapUpdate.Threads", 1);
+    _int_configs[CONFIG_GRID_PRELOAD_THREADS]        = sConfigMgr->GetOption<int32>("MapUpdate.GridPreloadThreads", 1);
+    _int_configs[CONFIG_GRID_PRELOAD_LOOKAHEAD]      = sConfigMgr->GetOption<int32>("MapUpdate.GridPreloadLookahead", 15);
     _int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = sConfigMgr->GetOption<int32>("Command.LookupMaxResults", 0);
 
     // Warden
@@ -1388,6 +1394,15 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_ENABLE_MMAPS]       = sConfigMgr->GetOption<bool>("MoveMaps.Enable", true);
     MMAP::MMapFactory::InitializeDisabledMaps();
 
+    _bool_configs[CONFIG_MOVEMENT_RELAY_COALESCING]  = sConfigMgr->GetOption<bool>("Movement.RelayCoalescing.Enable", false);
+    _float_configs[CONFIG_MOVEMENT_RELAY_FAR_DISTANCE] = sConfigMgr->GetOption<float>("Movement.RelayCoalescing.FarDistance", 60.0f);
+    _int_configs[CONFIG_MOVEMENT_RELAY_FAR_RATE]     = sConfigMgr->GetOption<int32>("Movement.RelayCoalescing.FarRate", 2);
+
+    _bool_configs[CONFIG_SCRIPT_PROFILER_ENABLE]     = sConfigMgr->GetOption<bool>("ScriptProfiler.Enable", false);
+    _int_configs[CONFIG_SCRIPT_PROFILER_DUMP_INTERVAL] = sConfigMgr->GetOption<int32>("ScriptProfiler.DumpInterval", 0);
+    sScriptProfiler->SetEnabled(_bool_configs[CONFIG_SCRIPT_PROFILER_ENABLE]);
+    sScriptProfiler->SetDumpSettings(_int_configs[CONFIG_SCRIPT_PROFILER_DUMP_INTERVAL] * IN_MILLISECONDS, sConfigMgr->GetOption<std::string>("ScriptProfiler.DumpFile", "ScriptProfile.log"));
+
     // Wintergrasp
     _int_configs[CONFIG_WINTERGRASP_ENABLE]              = sConfigMgr->GetOption<int32>("Wintergrasp.Enable", 1);
     _int_configs[CONFIG_WINTERGRASP_PLR_MAX]             = sConfigMgr->GetOption<int32>("Wintergrasp.PlayerMax", 100);
@@ -1457,6 +1472,7 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_DEBUG_ARENA]        = sConfigMgr->GetOption<bool>("Debug.Arena",        false);
 
     _int_configs[CONFIG_GM_LEVEL_CHANNEL_MODERATION] = sConfigMgr->GetOption<int32>("Channel.ModerationGMLevel", 1);
+    _int_configs[CONFIG_CHANNEL_FANOUT_MIN_MEMBERS]  = sConfigMgr->GetOption<int32>("Channel.Fanout.MinMembers", 500);
 
     _bool_configs[CONFIG_SET_BOP_ITEM_TRADEABLE] = sConfigMgr->GetOption<bool>("Item.SetItemTradeable", true);
 
@@ -2279,6 +2295,13 @@ void World::Update(uint32 diff)
         sWhoListCacheMgr->Update();
     }
 
+    sScriptProfiler->Update(diff);
+
+    {
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Save guild log journal"));
+        sGuildMgr->Update(diff);
+    }
+
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Check quest reset times"));
 
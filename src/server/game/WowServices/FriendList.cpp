@@ -16,7 +16,10 @@
 #include "Player.h"
 #include "WowConnection.h"
 
+#include <algorithm>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 
 /******************************************************************************
@@ -38,6 +41,32 @@
 static std::map<WOWGUID, FriendList * > s_friendListMap;
 static bool s_initialized;
 
+// Reverse ignore index: ignored guid -> sorted guids of the online players ignoring it
+static std::unordered_map<WOWGUID, std::vector<WOWGUID> > s_ignoredByMap;
+
+//=============================================================================
+static void IgnoredByAdd (WOWGUID const & ignored, WOWGUID const & owner) {
+    std::vector<WOWGUID> & ignoredBy = s_ignoredByMap[ignored];
+    auto pos = std::lower_bound(ignoredBy.begin(), ignoredBy.end(), owner);
+    if (pos == ignoredBy.end() || * pos != owner)
+        ignoredBy.insert(pos, owner);
+}
+
+//=============================================================================
+static void IgnoredByRemove (WOWGUID const & ignored, WOWGUID const & owner) {
+    auto itr = s_ignoredByMap.find(ignored);
+    if (itr == s_ignoredByMap.end())
+        return;
+
+    std::vector<WOWGUID> & ignoredBy = itr->second;
+    auto pos = std::lower_bound(ignoredBy.begin(), ignoredBy.end(), owner);
+    if (pos != ignoredBy.end() && * pos == owner)
+        ignoredBy.erase(pos);
+
+    if (ignoredBy.empty())
+        s_ignoredByMap.erase(itr);
+}
+
 //=============================================================================
 static void AddFriendHandler (
     User *          user,
@@ -190,6 +219,7 @@ void FriendListDestroy () {
     for (auto i = s_friendListMap.begin(); i != s_friendListMap.end(); i++) {
         s_friendListMap.erase(i);
     }
+    s_ignoredByMap.clear();
 
     // Unregister message handlers
     WowConnection::ClearMessageHandler(CMSG_WHOIS);
@@ -204,6 +234,18 @@ void FriendListDestroy () {
 }
 
 
+//=============================================================================
+void FriendListGetIgnoredBy (WOWGUID const & guid, std::vector<WOWGUID> * ignoredBy) {
+    ASSERT(ignoredBy);
+
+    auto itr = s_ignoredByMap.find(guid);
+    if (itr != s_ignoredByMap.end())
+        * ignoredBy = itr->second;
+    else
+        ignoredBy->clear();
+}
+
+
 //=============================================================================
 void FriendList::Friend::SetName (char const * name) {
     if (!name)
@@ -321,6 +363,7 @@ FRIEND_RESULT FriendList::AddIgnore (WOWGUID const & guid) {
     }
 
     m_ignore[i] = guid;
+    IgnoredByAdd(guid, m_playerPtr->GetGUID());
 
     // Save the ignored contact to the database
     CharacterDatabase.Execute(
@@ -339,6 +382,7 @@ FRIEND_RESULT FriendList::DelIgnore (WOWGUID const & guid) {
     for (uint32_t i = 0; i < GetNumIgnores(); i++) {
         if (m_ignore[i] == guid) {
             m_ignore[i] = WOWGUID();
+            IgnoredByRemove(guid, m_playerPtr->GetGUID());
 
             // Delete the ignored contact from the database
             CharacterDatabase.Execute(
@@ -471,6 +515,7 @@ void FriendList::AddContacts () {
         }
         else if ((flags & CONTACT_IGNORED) != 0 && iIgnore < NUM_MAX_IGNORE) {
             m_ignore[iIgnore++] = guid;
+            IgnoredByAdd(guid, m_playerPtr->GetGUID());
         }
         else if ((flags & CONTACT_MUTED) != 0 && iMute < NUM_MAX_MUTE) {
             m_mute[iMute++] = guid;
@@ -553,6 +598,12 @@ FriendList::~FriendList () {
         SaveContact(m_mute[i], CONTACT_MUTED, "");
     }
 
+    // Drop this player from the reverse ignore index
+    for (uint32_t i = 0; i < NUM_MAX_IGNORE; i++) {
+        if (m_ignore[i])
+            IgnoredByRemove(m_ignore[i], m_playerPtr->GetGUID());
+    }
+
     // Remove this FriendList object reference from the global hash table
     s_friendListMap.erase(m_playerPtr->GetGUID());
 }
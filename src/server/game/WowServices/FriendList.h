@@ -13,6 +13,7 @@
 
 
 #include <list>
+#include <vector>
 
 
 /******************************************************************************
@@ -35,6 +36,9 @@
 extern void FriendListInitialize ();
 extern void FriendListDestroy ();
 
+// Sorted guids of the online players ignoring the given player
+extern void FriendListGetIgnoredBy (WOWGUID const & guid, std::vector<WOWGUID> * ignoredBy);
+
 
 /******************************************************************************
 *
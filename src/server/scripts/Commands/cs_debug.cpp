@@ -38,6 +38,7 @@
 #include "ObjectMgr.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
+#include "ScriptProfiler.h"
 #include "Transport.h"
 #include "Warden.h"
 #include <fstream>
@@ -74,6 +75,14 @@ public:
             { "setphaseshift",  HandleDebugSendSetPhaseShiftCommand,   SEC_ADMINISTRATOR, Console::No },
             { "spellfail",      HandleDebugSendSpellFailCommand,       SEC_ADMINISTRATOR, Console::No }
         };
+        static ChatCommandTable debugScriptProfileCommandTable =
+        {
+            { "enable",         HandleDebugScriptProfileEnableCommand,  SEC_ADMINISTRATOR, Console::Yes },
+            { "disable",        HandleDebugScriptProfileDisableCommand, SEC_ADMINISTRATOR, Console::Yes },
+            { "reset",          HandleDebugScriptProfileResetCommand,   SEC_ADMINISTRATOR, Console::Yes },
+            { "show",           HandleDebugScriptProfileShowCommand,    SEC_ADMINISTRATOR, Console::Yes },
+            { "dump",           HandleDebugScriptProfileDumpCommand,    SEC_ADMINISTRATOR, Console::Yes }
+        };
         static ChatCommandTable debugCommandTable =
         {
             { "setbit",         HandleDebugSet32BitCommand,            SEC_ADMINISTRATOR, Console::No },
@@ -104,6 +113,7 @@ public:
             { "moveflags",      HandleDebugMoveflagsCommand,           SEC_ADMINISTRATOR, Console::No },
             { "unitstate",      HandleDebugUnitStateCommand,           SEC_ADMINISTRATOR, Console::No },
             { "objectcount",    HandleDebugObjectCountCommand,         SEC_ADMINISTRATOR, Console::Yes},
+            { "scriptprofile",  debugScriptProfileCommandTable },
             { "dummy",          HandleDebugDummyCommand,               SEC_ADMINISTRATOR, Console::No }
         };
         static ChatCommandTable commandTable =
@@ -1347,6 +1357,56 @@ public:
             handler->PSendSysMessage("Entry: %u Count: %u", p.first, p.second);
     }
 
+    static bool HandleDebugScriptProfileEnableCommand(ChatHandler* handler)
+    {
+        sScriptProfiler->SetEnabled(true);
+        handler->SendSysMessage("Script profiler enabled.");
+        return true;
+    }
+
+    static bool HandleDebugScriptProfileDisableCommand(ChatHandler* handler)
+    {
+        sScriptProfiler->SetEnabled(false);
+        handler->SendSysMessage("Script profiler disabled.");
+        return true;
+    }
+
+    static bool HandleDebugScriptProfileResetCommand(ChatHandler* handler)
+    {
+        sScriptProfiler->Reset();
+        handler->SendSysMessage("Script profile data cleared.");
+        return true;
+    }
+
+    static bool HandleDebugScriptProfileShowCommand(ChatHandler* handler, Optional<uint32> count)
+    {
+        ScriptProfileReport report = sScriptProfiler->BuildReport(count.value_or(10));
+        if (report.empty())
+        {
+            handler->PSendSysMessage("No script profile data, the profiler is %s.", sScriptProfiler->IsEnabled() ? "enabled" : "disabled");
+            return true;
+        }
+
+        handler->SendSysMessage("Total ms | Calls | Avg us | Max us | Entry");
+        for (auto const& [key, stats] : report)
+            handler->PSendSysMessage("%.3f | %u | %.1f | %.1f | %s", stats.TotalTime / 1000000.0, stats.Calls,
+                stats.TotalTime / 1000.0 / stats.Calls, stats.MaxTime / 1000.0, ScriptProfiler::GetKeyDescription(key));
+
+        return true;
+    }
+
+    static bool HandleDebugScriptProfileDumpCommand(ChatHandler* handler)
+    {
+        if (!sScriptProfiler->DumpToFile())
+        {
+            handler->SendErrorMessage("Unable to write the script profile, check ScriptProfiler.DumpFile.");
+            return false;
+        }
+
+        handler->SendSysMessage("Script profile written.");
+        return true;
+    }
+
     static bool HandleDebugDummyCommand(ChatHandler* handler)
     {
         handler->SendSysMessage("This command does nothing right now. Edit your local core (cs_debug.cpp) to make it do whatever you need for testing.");
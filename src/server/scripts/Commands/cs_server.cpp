@@ -239,7 +239,8 @@ public:
         handler->PSendSysMessage("Latest WorldDatabase update: %s", lwdb.c_str());
 
         handler->PSendSysMessage("LoginDatabase queue size: %zu", LoginDatabase.QueueSize());
-        handler->PSendSysMessage("CharacterDatabase queue size: %zu", CharacterDatabase.QueueSize());
+        handler->PSendSysMessage("CharacterDatabase queue size: %zu (high: %zu, normal: %zu, low: %zu)", CharacterDatabase.QueueSize(),
+            CharacterDatabase.QueueSize(SQL_PRIORITY_HIGH), CharacterDatabase.QueueSize(SQL_PRIORITY_NORMAL), CharacterDatabase.QueueSize(SQL_PRIORITY_LOW));
         handler->PSendSysMessage("WorldDatabase queue size: %zu", WorldDatabase.QueueSize());
 
         if (Acore::Module::GetEnableModulesList().empty())
@@ -607,7 +607,7 @@ public:
             if (!quest)
                 continue;
 
-            ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, quest->GetQuestId());
+            ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, quest->GetQuestId());
             if (!sConditionMgr->IsObjectMeetToConditions(player, conditions))
                 continue;
 
@@ -635,7 +635,7 @@ public:
             if (!quest)
                 continue;
 
-            ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, quest->GetQuestId());
+            ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, quest->GetQuestId());
             if (!sConditionMgr->IsObjectMeetToConditions(player, conditions))
                 continue;
 
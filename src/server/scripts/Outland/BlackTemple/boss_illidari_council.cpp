@@ -109,10 +109,10 @@ public:
     {
         if (Player* target = ObjectAccessor::GetPlayer(_owner, _targetGUID))
         {
-            target->m_clientGUIDs.insert(_owner.GetGUID());
+            target->AddClientGUID(&_owner);
             _owner.CastSpell(target, SPELL_ENVENOM, true);
             target->RemoveAurasDueToSpell(SPELL_DEADLY_POISON);
-            target->m_clientGUIDs.erase(_owner.GetGUID());
+            target->RemoveClientGUID(&_owner);
         }
         return true;
     }
@@ -626,7 +626,7 @@ class spell_illidari_council_empyreal_balance : public SpellScript
         }
 
         auto const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-        for (std::list<TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+        for (TargetInfoList::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
             if (Creature* target = ObjectAccessor::GetCreature(*GetCaster(), ihit->targetGUID))
             {
                 target->SetMaxHealth(GetCaster()->GetMaxHealth() / _targetCount);
@@ -668,7 +668,7 @@ class spell_illidari_council_empyreal_equivalency : public SpellScript
             return;
 
         auto const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-        for (std::list<TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+        for (TargetInfoList::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
             if (Creature* target = ObjectAccessor::GetCreature(*GetCaster(), ihit->targetGUID))
                 target->SetHealth(GetCaster()->GetHealth() / _targetCount);
     }
@@ -112,10 +112,10 @@ public:
     {
         if (Player* target = ObjectAccessor::GetPlayer(_owner, _targetGUID))
         {
-            target->m_clientGUIDs.insert(_owner.GetGUID());
+            target->AddClientGUID(&_owner);
             _owner.CastSpell(target, SPELL_ENVENOM, true);
             target->RemoveAurasDueToSpell(SPELL_DEADLY_POISON);
-            target->m_clientGUIDs.erase(_owner.GetGUID());
+            target->RemoveClientGUID(&_owner);
         }
         return true;
     }
@@ -608,8 +608,8 @@ class spell_illidari_council_empyreal_balance : public SpellScript
         }
 
         float pct = (_sharedHealth / _sharedHealthMax) * 100.0f;
-        std::list<TargetInfo> const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-        for (std::list<TargetInfo>::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+        TargetInfoList const* targetsInfo = GetSpell()->GetUniqueTargetInfo();
+        for (TargetInfoList::const_iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
             if (Creature* target = ObjectAccessor::GetCreature(*GetCaster(), ihit->targetGUID))
             {
                 target->LowerPlayerDamageReq(target->GetMaxHealth());
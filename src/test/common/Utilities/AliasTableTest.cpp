@@ -0,0 +1,66 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AliasTable.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    // Sweeps the whole [0, 1) roll range on a regular grid, which gives the exact
+    // share of every index up to the grid resolution
+    std::vector<double> Distribution(Acore::AliasTable const& table, std::size_t steps)
+    {
+        std::vector<double> hits(table.size(), 0.0);
+        for (std::size_t i = 0; i < steps; ++i)
+            ++hits[table.Pick((i + 0.5) / steps)];
+
+        for (double& hit : hits)
+            hit /= steps;
+
+        return hits;
+    }
+}
+
+TEST(AliasTableTest, MatchesWeights)
+{
+    Acore::AliasTable table({ 35.0, 5.0, 0.5, 59.5 });
+    std::vector<double> shares = Distribution(table, 200000);
+
+    ASSERT_EQ(shares.size(), 4u);
+    EXPECT_NEAR(shares[0], 0.35, 0.0001);
+    EXPECT_NEAR(shares[1], 0.05, 0.0001);
+    EXPECT_NEAR(shares[2], 0.005, 0.0001);
+    EXPECT_NEAR(shares[3], 0.595, 0.0001);
+}
+
+TEST(AliasTableTest, ZeroWeightIsNeverPicked)
+{
+    Acore::AliasTable table({ 0.0, 1.0, 0.0, 3.0 });
+    std::vector<double> shares = Distribution(table, 100000);
+
+    EXPECT_EQ(shares[0], 0.0);
+    EXPECT_EQ(shares[2], 0.0);
+    EXPECT_NEAR(shares[1], 0.25, 0.0001);
+    EXPECT_NEAR(shares[3], 0.75, 0.0001);
+}
+
+TEST(AliasTableTest, SingleEntry)
+{
+    Acore::AliasTable table({ 2.0 });
+    EXPECT_EQ(table.Pick(0.0), 0u);
+    EXPECT_EQ(table.Pick(0.999999), 0u);
+}
@@ -0,0 +1,173 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LFGMgr.h"
+#include "LFGQueue.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <iterator>
+
+using namespace lfg;
+
+namespace
+{
+    LfgRolesMap MakeRoles(uint32 firstGuid, std::initializer_list<uint8> roles)
+    {
+        LfgRolesMap rolesMap;
+        for (uint8 role : roles)
+            rolesMap[WOWGUID::Create<HighGuid::Player>(firstGuid++)] = role;
+        return rolesMap;
+    }
+
+    // Role and dungeon checks of LFGQueue::CheckCompatibility on the full role maps and dungeon sets
+    LfgCompatibility FullCheck(std::array<LfgQueueData*, 5> const& queues)
+    {
+        LfgRolesMap proposalRoles;
+        LfgDungeonSet proposalDungeons = queues[0]->dungeons;
+        for (uint8 i = 0; i < 5 && queues[i]; ++i)
+        {
+            proposalRoles.insert(queues[i]->roles.begin(), queues[i]->roles.end());
+
+            LfgDungeonSet temporal;
+            std::set_intersection(proposalDungeons.begin(), proposalDungeons.end(), queues[i]->dungeons.begin(), queues[i]->dungeons.end(), std::inserter(temporal, temporal.begin()));
+            proposalDungeons = temporal;
+        }
+
+        uint8 roleCheckResult = LFGMgr::CheckGroupRoles(proposalRoles);
+        if (!roleCheckResult || roleCheckResult > 0xF)
+            return LFG_INCOMPATIBLES_NO_ROLES;
+
+        if (proposalDungeons.empty())
+            return LFG_INCOMPATIBLES_NO_DUNGEONS;
+
+        return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
+    }
+
+    LfgCompatibility Prefilter(std::array<LfgQueueData*, 5> const& queues)
+    {
+        LfgDungeonMask dungeonMask;
+        bool dungeonsFromMask = false;
+        return LFGQueue::CheckQueueDataCompatibility(queues, dungeonMask, dungeonsFromMask);
+    }
+}
+
+TEST(LFGQueueTest, QueueDataDungeonMask)
+{
+    LfgRolesMap roles;
+    roles[WOWGUID::Create<HighGuid::Player>(1)] = PLAYER_ROLE_DAMAGE;
+
+    LfgQueueData data(0, LfgDungeonSet{ 1, 42, 261 }, roles);
+    EXPECT_TRUE(data.hasDungeonMask);
+    EXPECT_EQ(data.dungeonMask.count(), 3u);
+    EXPECT_TRUE(data.dungeonMask.test(1));
+    EXPECT_TRUE(data.dungeonMask.test(42));
+    EXPECT_TRUE(data.dungeonMask.test(261));
+
+    LfgQueueData outOfRange(0, LfgDungeonSet{ 1, LFG_DUNGEON_MASK_SIZE }, roles);
+    EXPECT_FALSE(outOfRange.hasDungeonMask);
+}
+
+TEST(LFGQueueTest, QueueDataRoleCounters)
+{
+    LfgRolesMap roles;
+    roles[WOWGUID::Create<HighGuid::Player>(1)] = PLAYER_ROLE_TANK | PLAYER_ROLE_LEADER;
+    roles[WOWGUID::Create<HighGuid::Player>(2)] = PLAYER_ROLE_HEALER;
+    roles[WOWGUID::Create<HighGuid::Player>(3)] = PLAYER_ROLE_DAMAGE;
+    roles[WOWGUID::Create<HighGuid::Player>(4)] = PLAYER_ROLE_DAMAGE;
+    roles[WOWGUID::Create<HighGuid::Player>(5)] = PLAYER_ROLE_TANK | PLAYER_ROLE_DAMAGE;
+
+    LfgQueueData data(0, LfgDungeonSet{ 1 }, roles);
+    EXPECT_EQ(data.onlyTanks, 1);
+    EXPECT_EQ(data.onlyHealers, 1);
+    EXPECT_EQ(data.onlyDps, 2);
+}
+
+TEST(LFGQueueTest, PrefilterRejectsLockedRoles)
+{
+    LfgQueueData tank(0, LfgDungeonSet{ 1 }, MakeRoles(1, { PLAYER_ROLE_TANK | PLAYER_ROLE_LEADER }));
+    LfgQueueData otherTank(0, LfgDungeonSet{ 1 }, MakeRoles(2, { PLAYER_ROLE_TANK }));
+    std::array<LfgQueueData*, 5> queues = { &tank, &otherTank };
+
+    EXPECT_EQ(Prefilter(queues), LFG_INCOMPATIBLES_NO_ROLES);
+    EXPECT_EQ(FullCheck(queues), LFG_INCOMPATIBLES_NO_ROLES);
+
+    LfgQueueData dps(0, LfgDungeonSet{ 1 }, MakeRoles(3, { PLAYER_ROLE_DAMAGE, PLAYER_ROLE_DAMAGE }));
+    LfgQueueData otherDps(0, LfgDungeonSet{ 1 }, MakeRoles(5, { PLAYER_ROLE_DAMAGE, PLAYER_ROLE_DAMAGE }));
+    queues = { &dps, &otherDps };
+
+    EXPECT_EQ(Prefilter(queues), LFG_INCOMPATIBLES_NO_ROLES);
+    EXPECT_EQ(FullCheck(queues), LFG_INCOMPATIBLES_NO_ROLES);
+}
+
+TEST(LFGQueueTest, PrefilterRejectsDisjointDungeons)
+{
+    LfgQueueData first(0, LfgDungeonSet{ 1, 42 }, MakeRoles(1, { PLAYER_ROLE_TANK }));
+    LfgQueueData second(0, LfgDungeonSet{ 43, 261 }, MakeRoles(2, { PLAYER_ROLE_HEALER }));
+    std::array<LfgQueueData*, 5> queues = { &first, &second };
+
+    EXPECT_EQ(Prefilter(queues), LFG_INCOMPATIBLES_NO_DUNGEONS);
+    EXPECT_EQ(FullCheck(queues), LFG_INCOMPATIBLES_NO_DUNGEONS);
+}
+
+TEST(LFGQueueTest, PrefilterAcceptsCompatibleCombination)
+{
+    LfgQueueData group(0, LfgDungeonSet{ 1, 42, 261 }, MakeRoles(1, { PLAYER_ROLE_TANK | PLAYER_ROLE_LEADER, PLAYER_ROLE_DAMAGE }));
+    LfgQueueData healer(0, LfgDungeonSet{ 42, 261 }, MakeRoles(3, { PLAYER_ROLE_HEALER | PLAYER_ROLE_DAMAGE }));
+    LfgQueueData dps(0, LfgDungeonSet{ 42 }, MakeRoles(4, { PLAYER_ROLE_DAMAGE, PLAYER_ROLE_TANK | PLAYER_ROLE_DAMAGE }));
+    std::array<LfgQueueData*, 5> queues = { &group, &healer, &dps };
+
+    LfgDungeonMask dungeonMask;
+    bool dungeonsFromMask = false;
+    EXPECT_EQ(LFGQueue::CheckQueueDataCompatibility(queues, dungeonMask, dungeonsFromMask), LFG_COMPATIBLES_WITH_LESS_PLAYERS);
+    EXPECT_EQ(FullCheck(queues), LFG_COMPATIBLES_WITH_LESS_PLAYERS);
+
+    // the common dungeons of the mask match the intersection of the dungeon sets
+    EXPECT_TRUE(dungeonsFromMask);
+    EXPECT_EQ(dungeonMask.count(), 1u);
+    EXPECT_TRUE(dungeonMask.test(42));
+}
+
+TEST(LFGQueueTest, PrefilterLeavesFlexibleRolesToFullCheck)
+{
+    // nobody is locked to a single role, only the full role check sees that there is no healer
+    LfgQueueData first(0, LfgDungeonSet{ 1 }, MakeRoles(1, { PLAYER_ROLE_TANK | PLAYER_ROLE_DAMAGE, PLAYER_ROLE_TANK | PLAYER_ROLE_DAMAGE }));
+    LfgQueueData second(0, LfgDungeonSet{ 1 }, MakeRoles(3, { PLAYER_ROLE_TANK | PLAYER_ROLE_DAMAGE, PLAYER_ROLE_TANK | PLAYER_ROLE_DAMAGE, PLAYER_ROLE_TANK | PLAYER_ROLE_DAMAGE }));
+    std::array<LfgQueueData*, 5> queues = { &first, &second };
+
+    EXPECT_EQ(Prefilter(queues), LFG_COMPATIBLES_WITH_LESS_PLAYERS);
+    EXPECT_EQ(FullCheck(queues), LFG_INCOMPATIBLES_NO_ROLES);
+}
+
+TEST(LFGQueueTest, PrefilterFallsBackWithoutDungeonMask)
+{
+    LfgQueueData first(0, LfgDungeonSet{ 1, LFG_DUNGEON_MASK_SIZE }, MakeRoles(1, { PLAYER_ROLE_TANK }));
+    LfgQueueData second(0, LfgDungeonSet{ LFG_DUNGEON_MASK_SIZE }, MakeRoles(2, { PLAYER_ROLE_HEALER }));
+    LfgQueueData third(0, LfgDungeonSet{ 1 }, MakeRoles(3, { PLAYER_ROLE_DAMAGE }));
+
+    LfgDungeonMask dungeonMask;
+    bool dungeonsFromMask = true;
+    std::array<LfgQueueData*, 5> queues = { &first, &second };
+    EXPECT_EQ(LFGQueue::CheckQueueDataCompatibility(queues, dungeonMask, dungeonsFromMask), LFG_COMPATIBLES_WITH_LESS_PLAYERS);
+    EXPECT_FALSE(dungeonsFromMask);
+    EXPECT_EQ(FullCheck(queues), LFG_COMPATIBLES_WITH_LESS_PLAYERS);
+
+    // disjoint dungeons are then only found by the full check
+    queues = { &second, &third };
+    EXPECT_EQ(LFGQueue::CheckQueueDataCompatibility(queues, dungeonMask, dungeonsFromMask), LFG_COMPATIBLES_WITH_LESS_PLAYERS);
+    EXPECT_FALSE(dungeonsFromMask);
+    EXPECT_EQ(FullCheck(queues), LFG_INCOMPATIBLES_NO_DUNGEONS);
+}